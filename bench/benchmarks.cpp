@@ -0,0 +1,287 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: benchmarks.cpp
+ * Description:
+ * The MazeGenBench suite - generation, rendering, saving, loading, solving
+ * and analysis over a sweep of maze sizes.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "harness.h"
+#include "maze_gen.h" // MazeGenerator - the code under test
+#include "fixed_maze.h" // FixedMazeGenerator
+#include "maze_io.h"  // Save formats
+#include "renderer.h" // RenderGrid
+#include "solver.h"   // Solver
+#include "kernels.h"  // Analysis kernels
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+namespace MazeGen {
+
+    /* Sizes
+        From the default menu maze up to 16k x 16k (268 million grid cells, 32 MB packed). Every
+        step is 4x wider and taller, so cells/s should stay flat across the sweep - a drop shows
+        where a buffer stops fitting in a cache level. Use --max-size to stop the sweep early.
+    */
+    struct SweepSize {
+        int width, height;
+    };
+
+    static const SweepSize kSizes[] = {
+        { 15, 9 }, { 63, 63 }, { 255, 255 }, { 1023, 1023 }, { 4095, 4095 }, { 16383, 16383 }
+    };
+
+    enum class FileFormat {
+        Binary,     // 1 bit per cell
+        Compressed, // 1 bit per cell, bit plane filtered and LZ compressed
+        Legacy      // 1 byte per cell
+    };
+
+    static const char* fileFormatName(FileFormat format) {
+        switch (format) {
+        case FileFormat::Binary: return "binary";
+        case FileFormat::Compressed: return "compressed";
+        default: return "legacy";
+        }
+    }
+
+    // ***********************************
+    // HELPERS
+    // ***********************************
+
+    // Every benchmark that needs a maze gets the same one for its size. Eller's algorithm is used
+    // since it is the fastest to set up at 16k x 16k.
+    static Maze makeMaze(int width, int height) {
+        MazeGenerator generator(width, height);
+        generator.SetAlgorithm(Algorithm::Eller);
+        generator.GenerateSeeded(1);
+        return generator.GetMaze();
+    }
+
+    static std::string tempFile(const std::string& name) {
+        std::error_code error;
+        std::filesystem::path dir = std::filesystem::temp_directory_path(error);
+        if (error) dir = ".";
+        return (dir / ("mazegen_bench_" + name + ".maze")).string();
+    }
+
+    static size_t fileSize(const std::string& filename) {
+        std::error_code error;
+        std::uintmax_t size = std::filesystem::file_size(filename, error);
+        return error ? 0 : static_cast<size_t>(size);
+    }
+
+    static bool saveAs(const std::string& filename, const Maze& maze, FileFormat format) {
+        if (format != FileFormat::Legacy) return SaveMazeFile(filename, maze, format == FileFormat::Compressed) == MazeError::None;
+
+        std::ofstream out(filename, std::ios::binary);
+        return WriteLegacyMaze(out, maze) && out.flush();
+    }
+
+    static std::FILE* openNullDevice() {
+#ifdef _WIN32
+        return std::fopen("NUL", "wb");
+#else
+        return std::fopen("/dev/null", "wb");
+#endif
+    }
+
+    // ***********************************
+    // BENCHMARKS
+    // ***********************************
+
+    static void benchGenerate(BenchState& state, Algorithm algorithm) {
+        MazeGenerator generator(state.Width(), state.Height());
+        generator.SetAlgorithm(algorithm);
+        generator.Reserve(state.Width(), state.Height()); // steady state - Allocs/iter should read 0
+
+        std::uint64_t seed = 1;
+        while (state.KeepRunning()) generator.GenerateSeeded(seed++);
+
+        state.SetCellsProcessed(state.Cells());
+        state.SetBytesProcessed(generator.GetMaze().m_Grid.WordCount() * sizeof(Grid::Word)); // packed grid written
+    }
+
+    template <int W, int H>
+    static void benchGenerateFixed(BenchState& state) {
+        auto generator = std::make_unique<FixedMazeGenerator<W, H>>(); // its arrays are too big for the stack at the larger sizes
+
+        std::uint64_t seed = 1;
+        while (state.KeepRunning()) generator->GenerateSeeded(seed++);
+
+        state.SetCellsProcessed(state.Cells());
+        state.SetBytesProcessed(sizeof(typename FixedMazeGenerator<W, H>::Words));
+    }
+
+    static void benchRender(BenchState& state, RenderStyle style, bool color) {
+        Maze maze = makeMaze(state.Width(), state.Height());
+        RenderOptions options;
+        options.style = style;
+        options.color = color;
+
+        // The null device cannot say how much was written, so render once into a real file for the byte count
+        const std::string filename = tempFile("render");
+        std::FILE* file = std::fopen(filename.c_str(), "wb");
+        if (!file || !RenderGrid(maze.m_Grid, file, options)) {
+            if (file) std::fclose(file);
+            state.SkipWithError("could not render to " + filename);
+            return;
+        }
+        std::fclose(file);
+        size_t bytes = fileSize(filename);
+        std::remove(filename.c_str());
+
+        std::FILE* sink = openNullDevice();
+        if (!sink) {
+            state.SkipWithError("could not open the null device");
+            return;
+        }
+        while (state.KeepRunning()) RenderGrid(maze.m_Grid, sink, options);
+        std::fclose(sink);
+
+        state.SetCellsProcessed(state.Cells());
+        state.SetBytesProcessed(bytes);
+    }
+
+    static void benchSave(BenchState& state, FileFormat format) {
+        Maze maze = makeMaze(state.Width(), state.Height());
+        const std::string filename = tempFile(std::string("save_") + fileFormatName(format));
+
+        while (state.KeepRunning()) {
+            if (!saveAs(filename, maze, format)) {
+                state.SkipWithError("could not write " + filename);
+                break;
+            }
+        }
+
+        state.SetCellsProcessed(state.Cells());
+        state.SetBytesProcessed(fileSize(filename));
+        std::remove(filename.c_str());
+    }
+
+    static void benchLoad(BenchState& state, FileFormat format, LoadMode mode) {
+        const std::string filename = tempFile(std::string("load_") + fileFormatName(format));
+        {
+            Maze maze = makeMaze(state.Width(), state.Height());
+            if (!saveAs(filename, maze, format)) {
+                state.SkipWithError("could not write " + filename);
+                return;
+            }
+        } // the generated maze is gone before the timing starts, so peak memory is the loader's alone
+
+        Maze loaded;
+        while (state.KeepRunning()) {
+            if (LoadMazeFile(filename, loaded, mode) != MazeError::None) {
+                state.SkipWithError("could not load " + filename);
+                break;
+            }
+        }
+
+        loaded = Maze(); // release a mapping before removing the file
+        state.SetCellsProcessed(state.Cells());
+        state.SetBytesProcessed(fileSize(filename));
+        std::remove(filename.c_str());
+    }
+
+    static void benchSolve(BenchState& state, SolveMethod method) {
+        Maze maze = makeMaze(state.Width(), state.Height());
+        Solver solver;
+        Solution solution;
+
+        while (state.KeepRunning()) {
+            if (!solver.Solve(maze.m_Grid, method, solution)) {
+                state.SkipWithError("maze has no solution");
+                break;
+            }
+        }
+
+        state.SetCellsProcessed(state.Cells());
+        state.SetBytesProcessed(maze.m_Grid.WordCount() * sizeof(Grid::Word));
+    }
+
+    static void benchDeadEnds(BenchState& state) {
+        Maze maze = makeMaze(state.Width(), state.Height());
+
+        size_t deadEnds = 0;
+        while (state.KeepRunning()) deadEnds += CountDeadEnds(maze.m_Grid);
+        if (deadEnds == 0) state.SkipWithError("no dead ends found"); // also keeps the loop from being optimised away
+
+        state.SetCellsProcessed(state.Cells());
+        state.SetBytesProcessed(maze.m_Grid.WordCount() * sizeof(Grid::Word));
+    }
+
+    static void benchFloodFill(BenchState& state) {
+        Maze maze = makeMaze(state.Width(), state.Height());
+        Grid reach;
+
+        while (state.KeepRunning()) FloodFill(maze.m_Grid, 1, 1, reach);
+
+        state.SetCellsProcessed(state.Cells());
+        state.SetBytesProcessed(maze.m_Grid.WordCount() * sizeof(Grid::Word));
+    }
+
+    // ***********************************
+    // REGISTRATION
+    // ***********************************
+
+    void RegisterMazeBenchmarks() {
+        for (const SweepSize& size : kSizes) {
+            for (int i = 0; i < static_cast<int>(Algorithm::Count); i++) {
+                Algorithm algorithm = static_cast<Algorithm>(i);
+                RegisterBenchmark(std::string("generate/") + AlgorithmName(algorithm), size.width, size.height,
+                                  [algorithm](BenchState& state) { benchGenerate(state, algorithm); });
+            }
+        }
+
+        // Compile-time sized generators, each next to the dynamic backtracker at the same size (31x31 is not part of the sweep)
+        RegisterBenchmark("generate/backtracker", 31, 31, [](BenchState& state) { benchGenerate(state, Algorithm::Backtracker); });
+        RegisterBenchmark("generate_fixed/backtracker", 15, 9, benchGenerateFixed<15, 9>);
+        RegisterBenchmark("generate_fixed/backtracker", 31, 31, benchGenerateFixed<31, 31>);
+        RegisterBenchmark("generate_fixed/backtracker", 63, 63, benchGenerateFixed<63, 63>);
+        RegisterBenchmark("generate_fixed/backtracker", 255, 255, benchGenerateFixed<255, 255>);
+
+        for (const SweepSize& size : kSizes) {
+            RegisterBenchmark("render/ascii", size.width, size.height, [](BenchState& state) { benchRender(state, RenderStyle::Ascii, false); });
+            RegisterBenchmark("render/unicode", size.width, size.height, [](BenchState& state) { benchRender(state, RenderStyle::Unicode, false); });
+            RegisterBenchmark("render/unicode_color", size.width, size.height, [](BenchState& state) { benchRender(state, RenderStyle::Unicode, true); });
+        }
+
+        const FileFormat formats[] = { FileFormat::Binary, FileFormat::Compressed, FileFormat::Legacy };
+        for (const SweepSize& size : kSizes) {
+            for (FileFormat format : formats) {
+                RegisterBenchmark(std::string("save/") + fileFormatName(format), size.width, size.height,
+                                  [format](BenchState& state) { benchSave(state, format); });
+            }
+            for (FileFormat format : formats) {
+                RegisterBenchmark(std::string("load/") + fileFormatName(format), size.width, size.height,
+                                  [format](BenchState& state) { benchLoad(state, format, LoadMode::Read); });
+            }
+            RegisterBenchmark("load/mapped", size.width, size.height, [](BenchState& state) { benchLoad(state, FileFormat::Binary, LoadMode::Map); });
+            RegisterBenchmark("load/mapped_unchecked", size.width, size.height,
+                              [](BenchState& state) { benchLoad(state, FileFormat::Binary, LoadMode::MapUnchecked); });
+        }
+
+        for (const SweepSize& size : kSizes) {
+            for (int i = 0; i < static_cast<int>(SolveMethod::Count); i++) {
+                SolveMethod method = static_cast<SolveMethod>(i);
+                RegisterBenchmark(std::string("solve/") + SolveMethodName(method), size.width, size.height,
+                                  [method](BenchState& state) { benchSolve(state, method); });
+            }
+            RegisterBenchmark("analysis/dead_ends", size.width, size.height, benchDeadEnds);
+            RegisterBenchmark("analysis/flood_fill", size.width, size.height, benchFloodFill);
+        }
+    }
+
+}
@@ -0,0 +1,595 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: harness.cpp
+ * Description:
+ * Implements the benchmark harness - the timing loop, heap allocation counting,
+ * peak RSS, console output and the JSON report and comparison.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "harness.h"
+#include "kernels.h" // Used to record the active kernel level in the report
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#ifndef MAZEGEN_BUILD_TYPE
+#define MAZEGEN_BUILD_TYPE ""
+#endif
+
+// ***********************************
+// HEAP ALLOCATION COUNTING
+// ***********************************
+
+/* Counting Allocator
+
+    The benchmark binary replaces the global operator new and delete, so every heap allocation
+    made by the code under test - std::vector, std::string, std::make_unique - goes through the
+    counters below. Each block carries a small header with its size, which lets delete keep
+    track of how much is still in use and so the peak heap use of a benchmark.
+    The counters are atomic because the tiled generator and the thread pool allocate too.
+*/
+namespace {
+
+    std::atomic<std::uint64_t> s_AllocCount(0);
+    std::atomic<std::uint64_t> s_AllocBytes(0);
+    std::atomic<size_t> s_LiveBytes(0);
+    std::atomic<size_t> s_PeakBytes(0);
+
+    struct BlockHeader {
+        size_t size;
+        void* base; // what malloc returned - differs from the header position for over-aligned blocks
+    };
+
+    void* countedAlloc(size_t size, size_t alignment) {
+        if (alignment < alignof(std::max_align_t)) alignment = alignof(std::max_align_t);
+        void* base = std::malloc(size + alignment + sizeof(BlockHeader));
+        if (!base) return nullptr;
+
+        std::uintptr_t block = (reinterpret_cast<std::uintptr_t>(base) + sizeof(BlockHeader) + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        BlockHeader* header = reinterpret_cast<BlockHeader*>(block) - 1;
+        header->size = size;
+        header->base = base;
+
+        s_AllocCount.fetch_add(1, std::memory_order_relaxed);
+        s_AllocBytes.fetch_add(size, std::memory_order_relaxed);
+        size_t live = s_LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        size_t peak = s_PeakBytes.load(std::memory_order_relaxed);
+        while (live > peak && !s_PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+        return reinterpret_cast<void*>(block);
+    }
+
+    void countedFree(void* block) {
+        if (!block) return;
+        BlockHeader* header = static_cast<BlockHeader*>(block) - 1;
+        s_LiveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+        std::free(header->base);
+    }
+
+    void* countedNew(size_t size, size_t alignment) {
+        void* block = countedAlloc(size == 0 ? 1 : size, alignment);
+        if (!block) throw std::bad_alloc();
+        return block;
+    }
+
+}
+
+void* operator new(size_t size) { return countedNew(size, 0); }
+void* operator new[](size_t size) { return countedNew(size, 0); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size == 0 ? 1 : size, 0); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size == 0 ? 1 : size, 0); }
+void* operator new(size_t size, std::align_val_t align) { return countedNew(size, static_cast<size_t>(align)); }
+void* operator new[](size_t size, std::align_val_t align) { return countedNew(size, static_cast<size_t>(align)); }
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return countedAlloc(size == 0 ? 1 : size, static_cast<size_t>(align)); }
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return countedAlloc(size == 0 ? 1 : size, static_cast<size_t>(align)); }
+
+void operator delete(void* block) noexcept { countedFree(block); }
+void operator delete[](void* block) noexcept { countedFree(block); }
+void operator delete(void* block, const std::nothrow_t&) noexcept { countedFree(block); }
+void operator delete[](void* block, const std::nothrow_t&) noexcept { countedFree(block); }
+void operator delete(void* block, size_t) noexcept { countedFree(block); }
+void operator delete[](void* block, size_t) noexcept { countedFree(block); }
+void operator delete(void* block, std::align_val_t) noexcept { countedFree(block); }
+void operator delete[](void* block, std::align_val_t) noexcept { countedFree(block); }
+void operator delete(void* block, size_t, std::align_val_t) noexcept { countedFree(block); }
+void operator delete[](void* block, size_t, std::align_val_t) noexcept { countedFree(block); }
+void operator delete(void* block, std::align_val_t, const std::nothrow_t&) noexcept { countedFree(block); }
+void operator delete[](void* block, std::align_val_t, const std::nothrow_t&) noexcept { countedFree(block); }
+
+namespace MazeGen {
+
+    // ***********************************
+    // PEAK RSS
+    // ***********************************
+
+    /* Peak Resident Set Size
+        The most physical memory the process has held. Linux can reset the peak (writing 5 to
+        /proc/self/clear_refs), so there it is measured per benchmark. Elsewhere the peak only
+        grows, so a benchmark reports the peak of the whole run so far.
+    */
+    static void resetPeakRss() {
+#if defined(__linux__)
+        if (std::FILE* file = std::fopen("/proc/self/clear_refs", "w")) {
+            std::fputs("5", file);
+            std::fclose(file);
+        }
+#endif
+    }
+
+    static size_t peakRss() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return counters.PeakWorkingSetSize;
+        return 0;
+#else
+#if defined(__linux__)
+        if (std::FILE* file = std::fopen("/proc/self/status", "r")) {
+            char line[256];
+            size_t kb = 0;
+            while (std::fgets(line, sizeof(line), file)) {
+                if (std::strncmp(line, "VmHWM:", 6) == 0) {
+                    kb = static_cast<size_t>(std::strtoull(line + 6, nullptr, 10));
+                    break;
+                }
+            }
+            std::fclose(file);
+            if (kb > 0) return kb * 1024;
+        }
+#endif
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+        return static_cast<size_t>(usage.ru_maxrss); // bytes on macOS
+#else
+        return static_cast<size_t>(usage.ru_maxrss) * 1024; // kilobytes everywhere else
+#endif
+#endif
+    }
+
+    // ***********************************
+    // BENCH STATE
+    // ***********************************
+
+    BenchState::BenchState(int width, int height, double minSeconds, size_t maxIterations)
+        : m_Width(width), m_Height(height), m_MinSeconds(minSeconds), m_MaxIterations(maxIterations),
+          m_Started(false), m_Finished(false), m_Iterations(0), m_Seconds(0.0),
+          m_CellsPerIteration(0), m_BytesPerIteration(0), m_Allocations(0), m_AllocatedBytes(0),
+          m_HeapAtStart(0), m_PeakHeap(0) {}
+
+    bool BenchState::KeepRunning() {
+        if (m_Finished) return false;
+
+        if (!m_Started) {
+            m_Started = true;
+            m_Allocations = s_AllocCount.load(std::memory_order_relaxed);
+            m_AllocatedBytes = s_AllocBytes.load(std::memory_order_relaxed);
+            m_HeapAtStart = s_LiveBytes.load(std::memory_order_relaxed);
+            s_PeakBytes.store(m_HeapAtStart, std::memory_order_relaxed); // the peak from here on
+            m_Start = std::chrono::steady_clock::now();
+            return true;
+        }
+
+        m_Iterations++; // the previous call's iteration is done
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count();
+        if (elapsed < m_MinSeconds && m_Iterations < m_MaxIterations) return true;
+
+        m_Seconds = elapsed;
+        finish();
+        return false;
+    }
+
+    void BenchState::SkipWithError(const std::string& error) {
+        m_Error = error;
+        if (m_Started && !m_Finished) {
+            m_Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count();
+            finish();
+        }
+        m_Finished = true;
+    }
+
+    void BenchState::finish() {
+        m_Finished = true;
+        m_Allocations = s_AllocCount.load(std::memory_order_relaxed) - m_Allocations;
+        m_AllocatedBytes = s_AllocBytes.load(std::memory_order_relaxed) - m_AllocatedBytes;
+        size_t peak = s_PeakBytes.load(std::memory_order_relaxed);
+        m_PeakHeap = peak > m_HeapAtStart ? peak - m_HeapAtStart : 0;
+    }
+
+    // ***********************************
+    // RESULTS
+    // ***********************************
+
+    struct BenchResult {
+        std::string name;
+        size_t iterations = 0;
+        double seconds = 0.0;        // per iteration
+        double cellsPerSecond = 0.0;
+        double bytesPerSecond = 0.0;
+        double allocations = 0.0;    // heap allocations per iteration
+        double allocatedBytes = 0.0; // heap bytes requested per iteration
+        size_t peakHeapBytes = 0;    // most heap in use at once during the run, above what was in use before it
+        size_t peakRssBytes = 0;     // peak resident set size during the run (0 = unknown)
+        std::string error;
+    };
+
+    struct Registered {
+        std::string name;
+        int width, height;
+        BenchFunction function;
+    };
+
+    static std::vector<Registered>& registry() {
+        static std::vector<Registered> benchmarks; // function local so registering from static initialisers is safe
+        return benchmarks;
+    }
+
+    void RegisterBenchmark(const std::string& name, int width, int height, BenchFunction function) {
+        registry().push_back({ name + "/" + std::to_string(width) + "x" + std::to_string(height), width, height, std::move(function) });
+    }
+
+    static BenchResult runOne(const Registered& bench, double minSeconds) {
+        resetPeakRss();
+        BenchState state(bench.width, bench.height, minSeconds, 1000000000);
+        bench.function(state);
+
+        BenchResult result;
+        result.name = bench.name;
+        result.error = state.Error();
+        if (result.error.empty() && state.Iterations() == 0) result.error = "benchmark never called KeepRunning";
+        result.peakRssBytes = peakRss();
+        if (!result.error.empty()) return result;
+
+        double iterations = static_cast<double>(state.Iterations());
+        result.iterations = state.Iterations();
+        result.seconds = state.Seconds() / iterations;
+        if (result.seconds > 0.0) {
+            result.cellsPerSecond = static_cast<double>(state.CellsPerIteration()) / result.seconds;
+            result.bytesPerSecond = static_cast<double>(state.BytesPerIteration()) / result.seconds;
+        }
+        result.allocations = static_cast<double>(state.Allocations()) / iterations;
+        result.allocatedBytes = static_cast<double>(state.AllocatedBytes()) / iterations;
+        result.peakHeapBytes = state.PeakHeapBytes();
+        return result;
+    }
+
+    // ***********************************
+    // CONSOLE OUTPUT
+    // ***********************************
+
+    static std::string formatTime(double seconds) {
+        char text[32];
+        if (seconds < 1e-6) std::snprintf(text, sizeof(text), "%.1f ns", seconds * 1e9);
+        else if (seconds < 1e-3) std::snprintf(text, sizeof(text), "%.2f us", seconds * 1e6);
+        else if (seconds < 1.0) std::snprintf(text, sizeof(text), "%.2f ms", seconds * 1e3);
+        else std::snprintf(text, sizeof(text), "%.3f s", seconds);
+        return text;
+    }
+
+    static std::string formatScaled(double value, const char* unit, bool binary) { // 1.5 M/s, 2.3 GiB/s ...
+        static const char* const kPrefixes[] = { "", "k", "M", "G", "T" };
+        static const char* const kBinaryPrefixes[] = { "", "Ki", "Mi", "Gi", "Ti" };
+        const double base = binary ? 1024.0 : 1000.0;
+        int prefix = 0;
+        while (value >= base && prefix < 4) {
+            value /= base;
+            prefix++;
+        }
+        char text[32];
+        std::snprintf(text, sizeof(text), "%.3g %s%s", value, binary ? kBinaryPrefixes[prefix] : kPrefixes[prefix], unit);
+        return text;
+    }
+
+    static void printHeader() {
+        std::printf("%-36s %12s %10s %14s %14s %12s %12s %12s\n", "Benchmark", "Time", "Iterations",
+                    "Cells/s", "Bytes/s", "Allocs/iter", "Peak heap", "Peak RSS");
+        std::printf("%s\n", std::string(36 + 13 + 11 + 15 + 15 + 13 + 13 + 13, '-').c_str());
+    }
+
+    static void printResult(const BenchResult& result) {
+        if (!result.error.empty()) {
+            std::printf("%-36s ERROR: %s\n", result.name.c_str(), result.error.c_str());
+            return;
+        }
+        char allocs[32];
+        std::snprintf(allocs, sizeof(allocs), "%.1f", result.allocations);
+        std::printf("%-36s %12s %10zu %14s %14s %12s %12s %12s\n", result.name.c_str(), formatTime(result.seconds).c_str(),
+                    result.iterations, formatScaled(result.cellsPerSecond, "/s", false).c_str(),
+                    formatScaled(result.bytesPerSecond, "B/s", true).c_str(), allocs,
+                    formatScaled(static_cast<double>(result.peakHeapBytes), "B", true).c_str(),
+                    result.peakRssBytes ? formatScaled(static_cast<double>(result.peakRssBytes), "B", true).c_str() : "-");
+        std::fflush(stdout);
+    }
+
+    // ***********************************
+    // JSON REPORT
+    // ***********************************
+
+    /* Report Format
+        {
+          "context": { "build_type": "Release", "kernels": "avx2", "min_time": 0.5 },
+          "benchmarks": [
+            { "name": "generate/eller/1023x1023", "iterations": 52, "seconds_per_iteration": 0.0096, ... },
+            ...
+          ]
+        }
+        One benchmark per line, with a stable order and key set, so two reports also diff well as text.
+    */
+    static std::string jsonString(const std::string& text) {
+        std::string out = "\"";
+        for (char c : text) {
+            if (c == '"' || c == '\\') out += '\\';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    static bool writeJson(const std::string& filename, const std::vector<BenchResult>& results, double minSeconds) {
+        std::ofstream out(filename);
+        if (!out) return false;
+
+        char number[64];
+        auto num = [&](double value) { std::snprintf(number, sizeof(number), "%.9g", value); return std::string(number); };
+
+        out << "{\n  \"context\": { \"build_type\": " << jsonString(MAZEGEN_BUILD_TYPE)
+            << ", \"kernels\": " << jsonString(KernelLevelName(ActiveKernelLevel()))
+            << ", \"min_time\": " << num(minSeconds) << " },\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); i++) {
+            const BenchResult& r = results[i];
+            out << "    { \"name\": " << jsonString(r.name);
+            if (!r.error.empty()) out << ", \"error\": " << jsonString(r.error);
+            out << ", \"iterations\": " << r.iterations
+                << ", \"seconds_per_iteration\": " << num(r.seconds)
+                << ", \"cells_per_second\": " << num(r.cellsPerSecond)
+                << ", \"bytes_per_second\": " << num(r.bytesPerSecond)
+                << ", \"allocations_per_iteration\": " << num(r.allocations)
+                << ", \"allocated_bytes_per_iteration\": " << num(r.allocatedBytes)
+                << ", \"peak_heap_bytes\": " << r.peakHeapBytes
+                << ", \"peak_rss_bytes\": " << r.peakRssBytes << " }"
+                << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "  ]\n}\n";
+        return static_cast<bool>(out);
+    }
+
+    /* Reading Reports
+        Only needs to understand the reports written above: the objects inside the "benchmarks"
+        array, each a flat list of string or number values.
+    */
+    static bool readJson(const std::string& filename, std::vector<BenchResult>& results) {
+        std::ifstream in(filename);
+        if (!in) return false;
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        const std::string text = buffer.str();
+
+        size_t pos = text.find("\"benchmarks\"");
+        if (pos == std::string::npos || (pos = text.find('[', pos)) == std::string::npos) return false;
+
+        auto skipSpace = [&]() { while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) pos++; };
+        auto readString = [&](std::string& value) {
+            value.clear();
+            if (pos >= text.size() || text[pos] != '"') return false;
+            for (pos++; pos < text.size() && text[pos] != '"'; pos++) {
+                if (text[pos] == '\\' && pos + 1 < text.size()) pos++;
+                value += text[pos];
+            }
+            return pos++ < text.size();
+        };
+
+        pos++;
+        for (;;) {
+            skipSpace();
+            if (pos >= text.size()) return false;
+            if (text[pos] == ']') return true;
+            if (text[pos] == ',') { pos++; continue; }
+            if (text[pos] != '{') return false;
+            pos++;
+
+            BenchResult result;
+            std::map<std::string, double> numbers;
+            for (;;) {
+                skipSpace();
+                if (pos < text.size() && text[pos] == ',') { pos++; continue; }
+                if (pos < text.size() && text[pos] == '}') { pos++; break; }
+
+                std::string key, value;
+                if (!readString(key)) return false;
+                skipSpace();
+                if (pos >= text.size() || text[pos++] != ':') return false;
+                skipSpace();
+                if (pos < text.size() && text[pos] == '"') {
+                    if (!readString(value)) return false;
+                    if (key == "name") result.name = value;
+                    else if (key == "error") result.error = value;
+                }
+                else {
+                    char* end = nullptr;
+                    numbers[key] = std::strtod(text.c_str() + pos, &end);
+                    if (end == text.c_str() + pos) return false;
+                    pos = static_cast<size_t>(end - text.c_str());
+                }
+            }
+
+            result.iterations = static_cast<size_t>(numbers["iterations"]);
+            result.seconds = numbers["seconds_per_iteration"];
+            result.cellsPerSecond = numbers["cells_per_second"];
+            result.bytesPerSecond = numbers["bytes_per_second"];
+            result.allocations = numbers["allocations_per_iteration"];
+            result.allocatedBytes = numbers["allocated_bytes_per_iteration"];
+            result.peakHeapBytes = static_cast<size_t>(numbers["peak_heap_bytes"]);
+            result.peakRssBytes = static_cast<size_t>(numbers["peak_rss_bytes"]);
+            results.push_back(result);
+        }
+    }
+
+    /* Comparing
+        Matches benchmarks by name and prints the change in time per iteration. A benchmark is a
+        regression when it got slower by more than the threshold, or when it now makes more heap
+        allocations per iteration - an allocation count does not suffer from timing noise, so any
+        increase is worth a look.
+    */
+    static int compare(const std::vector<BenchResult>& before, const std::vector<BenchResult>& after, double thresholdPercent) {
+        std::map<std::string, const BenchResult*> old;
+        for (const BenchResult& r : before) old[r.name] = &r;
+
+        std::printf("\n%-36s %12s %12s %9s %14s\n", "Benchmark", "Before", "After", "Change", "Allocs/iter");
+        std::printf("%s\n", std::string(36 + 13 + 13 + 10 + 15 + 12, '-').c_str());
+
+        int regressions = 0;
+        for (const BenchResult& now : after) {
+            auto found = old.find(now.name);
+            if (found == old.end() || !now.error.empty() || !found->second->error.empty() || found->second->seconds <= 0.0) continue;
+            const BenchResult& was = *found->second;
+
+            double change = (now.seconds / was.seconds - 1.0) * 100.0;
+            bool slower = change > thresholdPercent;
+            bool moreAllocs = now.allocations > was.allocations + 0.5;
+            char allocs[48];
+            std::snprintf(allocs, sizeof(allocs), "%.1f -> %.1f", was.allocations, now.allocations);
+            std::printf("%-36s %12s %12s %+8.1f%% %14s%s\n", now.name.c_str(), formatTime(was.seconds).c_str(),
+                        formatTime(now.seconds).c_str(), change, allocs,
+                        slower ? "  REGRESSION" : (moreAllocs ? "  MORE ALLOCATIONS" : ""));
+            if (slower || moreAllocs) regressions++;
+        }
+
+        if (regressions > 0) {
+            std::printf("\n%d benchmark(s) regressed (threshold %.1f%%)\n", regressions, thresholdPercent);
+            return 1;
+        }
+        std::printf("\nNo regressions (threshold %.1f%%)\n", thresholdPercent);
+        return 0;
+    }
+
+    // ***********************************
+    // COMMAND LINE
+    // ***********************************
+
+    static void printBenchUsage() {
+        std::cout << R"(Usage: MazeGenBench [options]
+    --filter TEXT      only run benchmarks whose name contains TEXT
+    --max-size N       skip mazes wider or taller than N (default: every size)
+    --min-time S       run each benchmark for at least S seconds (default 0.5)
+    --json FILE        write the results as JSON
+    --compare FILE     compare the results with an earlier JSON report, exit code 1 on a regression
+    --input FILE       with --compare: compare this report instead of running the benchmarks
+    --threshold PCT    slowdown in percent that counts as a regression (default 10)
+    --list             list the benchmark names and exit
+)";
+    }
+
+    int RunBenchmarks(int argc, char* argv[]) {
+        std::string filter, jsonFile, compareFile, inputFile;
+        double minSeconds = 0.5, threshold = 10.0;
+        long long maxSize = -1;
+        bool list = false;
+
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            auto value = [&](std::string& out) {
+                if (i + 1 >= argc) return false;
+                out = argv[++i];
+                return true;
+            };
+            std::string text;
+            if (arg == "--filter" && value(filter)) continue;
+            if (arg == "--json" && value(jsonFile)) continue;
+            if (arg == "--compare" && value(compareFile)) continue;
+            if (arg == "--input" && value(inputFile)) continue;
+            if (arg == "--max-size" && value(text)) { maxSize = std::atoll(text.c_str()); continue; }
+            if (arg == "--min-time" && value(text)) { minSeconds = std::atof(text.c_str()); continue; }
+            if (arg == "--threshold" && value(text)) { threshold = std::atof(text.c_str()); continue; }
+            if (arg == "--list") { list = true; continue; }
+            if (arg == "--help" || arg == "-h") { printBenchUsage(); return 0; }
+
+            std::cerr << "Unknown or incomplete option '" << arg << "'\n\n";
+            printBenchUsage();
+            return 1;
+        }
+
+        std::vector<BenchResult> results;
+        if (!inputFile.empty()) {
+            if (compareFile.empty()) {
+                std::cerr << "--input needs --compare\n";
+                return 1;
+            }
+            if (!readJson(inputFile, results)) {
+                std::cerr << "Could not read the benchmark report " << inputFile << '\n';
+                return 1;
+            }
+        }
+        else {
+            std::vector<const Registered*> selected;
+            for (const Registered& bench : registry()) {
+                if (!filter.empty() && bench.name.find(filter) == std::string::npos) continue;
+                if (maxSize >= 0 && (bench.width > maxSize || bench.height > maxSize)) continue;
+                selected.push_back(&bench);
+            }
+
+            if (list) {
+                for (const Registered* bench : selected) std::cout << bench->name << '\n';
+                return 0;
+            }
+
+            std::string buildType = MAZEGEN_BUILD_TYPE;
+            if (buildType != "Release" && buildType != "RelWithDebInfo") {
+                std::printf("Warning: build type is '%s' - configure with -DCMAKE_BUILD_TYPE=Release for meaningful numbers\n", buildType.c_str());
+            }
+            std::printf("Kernels: %s, minimum time per benchmark: %gs\n\n", KernelLevelName(ActiveKernelLevel()), minSeconds);
+
+            printHeader();
+            for (const Registered* bench : selected) {
+                results.push_back(runOne(*bench, minSeconds));
+                printResult(results.back());
+            }
+
+            if (!jsonFile.empty()) {
+                if (!writeJson(jsonFile, results, minSeconds)) {
+                    std::cerr << "Could not write " << jsonFile << '\n';
+                    return 1;
+                }
+                std::printf("\nResults written to %s\n", jsonFile.c_str());
+            }
+        }
+
+        if (!compareFile.empty()) {
+            std::vector<BenchResult> baseline;
+            if (!readJson(compareFile, baseline)) {
+                std::cerr << "Could not read the benchmark report " << compareFile << '\n';
+                return 1;
+            }
+            return compare(baseline, results, threshold);
+        }
+
+        for (const BenchResult& result : results) {
+            if (!result.error.empty()) return 1;
+        }
+        return 0;
+    }
+
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: harness.h
+ * Description:
+ * Declares the benchmark harness used by MazeGenBench - registration, the
+ * timing loop, memory statistics and the JSON report.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace MazeGen {
+
+    /* Bench State
+
+        Handed to every benchmark. The benchmark does its setup, then runs the code it measures
+        in a loop:
+
+            while (state.KeepRunning()) generator.GenerateSeeded(seed++);
+
+        The clock starts at the first KeepRunning call, so the setup is not timed. The loop runs
+        until it took at least the minimum time (and always at least once), which keeps tiny
+        mazes from being measured on a single iteration and huge ones from running for minutes.
+        Heap allocations and peak memory are recorded over the same span.
+    */
+    class BenchState {
+    public:
+        BenchState(int width, int height, double minSeconds, size_t maxIterations);
+
+        bool KeepRunning(); // true while another iteration should run
+
+        int Width() const { return m_Width; }
+        int Height() const { return m_Height; }
+        size_t Cells() const { return static_cast<size_t>(m_Width) * static_cast<size_t>(m_Height); }
+
+        // Work done by one iteration - reported as cells/s and bytes/s
+        void SetCellsProcessed(size_t cells) { m_CellsPerIteration = cells; }
+        void SetBytesProcessed(size_t bytes) { m_BytesPerIteration = bytes; }
+
+        void SkipWithError(const std::string& error); // ends the loop, the benchmark is reported as failed
+
+        size_t Iterations() const { return m_Iterations; }
+        double Seconds() const { return m_Seconds; } // total time of all iterations
+        size_t CellsPerIteration() const { return m_CellsPerIteration; }
+        size_t BytesPerIteration() const { return m_BytesPerIteration; }
+        std::uint64_t Allocations() const { return m_Allocations; }       // over all iterations
+        std::uint64_t AllocatedBytes() const { return m_AllocatedBytes; } // over all iterations
+        size_t PeakHeapBytes() const { return m_PeakHeap; }
+        const std::string& Error() const { return m_Error; }
+
+    private:
+        int m_Width, m_Height;
+        double m_MinSeconds;
+        size_t m_MaxIterations;
+
+        bool m_Started;
+        bool m_Finished;
+        std::chrono::steady_clock::time_point m_Start;
+        size_t m_Iterations;
+        double m_Seconds;
+        size_t m_CellsPerIteration;
+        size_t m_BytesPerIteration;
+        std::uint64_t m_Allocations, m_AllocatedBytes; // counter values at the start, totals once finished
+        size_t m_HeapAtStart;
+        size_t m_PeakHeap;
+        std::string m_Error;
+
+        void finish();
+    };
+
+    using BenchFunction = std::function<void(BenchState&)>;
+
+    // Adds a benchmark run at the given maze size, e.g. RegisterBenchmark("generate/eller", 1023, 1023, ...)
+    // is reported as "generate/eller/1023x1023".
+    void RegisterBenchmark(const std::string& name, int width, int height, BenchFunction function);
+
+    /* Running
+
+        Runs every registered benchmark that matches the command line and prints one line per
+        benchmark. Options (see --help):
+            --filter TEXT      only benchmarks whose name contains TEXT
+            --max-size N       skip mazes wider or taller than N
+            --min-time S       minimum seconds per benchmark (default 0.5)
+            --json FILE        write the results as JSON
+            --compare FILE     compare the results with an earlier JSON report
+            --input FILE       with --compare: compare this report instead of running the benchmarks
+            --threshold PCT    slowdown that counts as a regression (default 10)
+            --list             print the names only
+        Returns 1 when --compare found a regression, so the run can fail a build.
+    */
+    int RunBenchmarks(int argc, char* argv[]);
+
+}
@@ -0,0 +1,29 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: main.cpp
+ * Description:
+ * Entry point of MazeGenBench. Registers the benchmark suite and runs it.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "harness.h"
+
+namespace MazeGen {
+    void RegisterMazeBenchmarks(); // benchmarks.cpp
+}
+
+using namespace MazeGen;
+
+int main(int argc, char* argv[]) {
+    RegisterMazeBenchmarks();
+    return RunBenchmarks(argc, argv);
+}
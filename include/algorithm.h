@@ -0,0 +1,198 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: algorithm.h
+ * Description:
+ * Declares the MazeAlgorithm interface, the available generation algorithms
+ * and the registry used to look them up by id or name.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "grid.h"
+#include "rng.h"    // Used for the random number source passed to every algorithm
+#include "stats.h"  // Used for the carve counters
+#include <array>
+#include <cstdint>
+#include <memory>   // Used for std::unique_ptr returned by the registry
+#include <string>
+#include <vector>
+
+namespace MazeGen {
+
+    // Every generation algorithm the project knows about. The order matches the driver menu.
+    enum class Algorithm {
+        Backtracker, // depth first search with an explicit stack - long winding corridors
+        Eller,       // row by row, only needs memory for one row
+        Kruskal,     // random edge order merged with a union-find
+        Prim,        // grows outward from a frontier set - lots of short dead ends
+        Wilson,      // loop-erased random walks - uniform spanning tree, unbiased
+        Count
+    };
+
+    /* Cells vs Grid Characters
+
+        Mazes are stored as a grid of characters where cells sit on odd coordinates and the
+        characters between them are walls that may be opened:
+
+            grid x:  0 1 2 3 4
+                     # # # # #
+                     # c w c #     c = cell, w = wall between two cells
+                     # # # # #
+
+        Algorithms think in cells. Cell (cx, cy) lives at grid position (2 * cx + 1, 2 * cy + 1).
+        A CellRegion is a rectangle of cells - the whole maze or only a part of it.
+    */
+    struct CellRegion {
+        int x, y;       // first cell of the region
+        int cols, rows; // size of the region in cells
+
+        int GridX(int cx) const { return 2 * (x + cx) + 1; } // cx and cy are relative to the region
+        int GridY(int cy) const { return 2 * (y + cy) + 1; }
+        size_t CellCount() const { return static_cast<size_t>(cols) * static_cast<size_t>(rows); }
+
+        // Region covering every cell of a width x height grid
+        static CellRegion Full(int width, int height) { return { 0, 0, (width - 1) / 2, (height - 1) / 2 }; }
+    };
+
+    /* MazeAlgorithm (Strategy Interface)
+
+        MazeGenerator does not know how a maze is carved, it only asks an algorithm to do it.
+        Each algorithm receives a grid that is filled with walls inside the region and must turn
+        the cells of that region into a perfect maze (every cell reachable, exactly one path
+        between any two cells). Nothing outside the region may be touched.
+
+        Algorithms are objects (not plain functions) so they can keep their scratch buffers
+        between calls instead of reallocating them every time a maze is generated. Reserve sizes
+        those buffers for the worst case of a region up front - every Carve calls it too, and it
+        only allocates when the region is bigger than any before, so carving the same size again
+        and again never touches the heap.
+    */
+    class MazeAlgorithm {
+    public:
+        virtual ~MazeAlgorithm() = default;
+
+        virtual Algorithm Id() const = 0;
+
+        virtual void Carve(Grid& grid, const CellRegion& region, Rng& rng) = 0;
+
+        virtual void Reserve(const CellRegion& region) = 0; // buffers for carving region, never shrinks them
+
+        // What Carve did since the last ResetCounters - Carve only ever adds to them, so the counters
+        // of several regions carved by one object add up. Always zero without MAZEGEN_ENABLE_STATS.
+        const CarveCounters& Counters() const { return m_Counters; }
+
+        void ResetCounters() { m_Counters = CarveCounters(); }
+
+    protected:
+        CarveCounters m_Counters;
+    };
+
+    // ***********************************
+    // ALGORITHMS
+    // ***********************************
+
+    class BacktrackerAlgorithm : public MazeAlgorithm {
+    public:
+        Algorithm Id() const override { return Algorithm::Backtracker; }
+        void Carve(Grid& grid, const CellRegion& region, Rng& rng) override;
+        void Reserve(const CellRegion& region) override;
+
+    private:
+        // One entry of the explicit carving stack - replaces a recursive call
+        struct Frame {
+            int x, y;                         // cell being carved (grid coordinates)
+            std::array<std::uint8_t, 4> dirs; // this cell's own shuffled direction order
+            int next;                         // index into dirs of the next direction to try (4 = done)
+        };
+
+        std::vector<Frame> m_Stack; // reused between generations, reserved to the cell count
+    };
+
+    // Eller's algorithm one row at a time. Used by EllerAlgorithm and by the streaming generator (stream.h).
+    class EllerRows {
+    public:
+        void Begin(int cols); // starts a new maze that is cols cells wide
+
+        void Reserve(int cols); // room for a maze up to cols cells wide
+
+        // Decides the passages of the next row of cells. After the call:
+        //     Right()[c] != 0 - the wall between cell c and c + 1 is open
+        //     Down()[c] != 0  - the wall below cell c is open (always 0 on the last row)
+        void NextRow(Rng& rng, bool lastRow);
+
+        const std::vector<std::uint8_t>& Right() const { return m_Right; }
+        const std::vector<std::uint8_t>& Down() const { return m_Down; }
+
+        size_t ScratchBytes() const; // memory held by the row buffers
+
+    private:
+        int m_Cols = 0;
+        std::vector<std::uint32_t> m_Sets, m_Parent, m_Count, m_Remap; // one entry per column
+        std::vector<std::uint8_t> m_Right, m_Down;
+
+        std::uint32_t m_Bits = 0; // random bits left over from the last call to the generator
+        int m_BitsLeft = 0;
+    };
+
+    class EllerAlgorithm : public MazeAlgorithm {
+    public:
+        Algorithm Id() const override { return Algorithm::Eller; }
+        void Carve(Grid& grid, const CellRegion& region, Rng& rng) override;
+        void Reserve(const CellRegion& region) override;
+
+    private:
+        EllerRows m_Rows;
+    };
+
+    class KruskalAlgorithm : public MazeAlgorithm {
+    public:
+        Algorithm Id() const override { return Algorithm::Kruskal; }
+        void Carve(Grid& grid, const CellRegion& region, Rng& rng) override;
+        void Reserve(const CellRegion& region) override;
+
+    private:
+        std::vector<std::uint32_t> m_Parent; // union-find forest, one entry per cell
+        std::vector<std::uint32_t> m_Edges;  // every inner wall as (cell index * 2 + direction)
+    };
+
+    class PrimAlgorithm : public MazeAlgorithm {
+    public:
+        Algorithm Id() const override { return Algorithm::Prim; }
+        void Carve(Grid& grid, const CellRegion& region, Rng& rng) override;
+        void Reserve(const CellRegion& region) override;
+
+    private:
+        std::vector<std::uint8_t> m_State;     // per cell: outside, frontier or in the maze
+        std::vector<std::uint32_t> m_Frontier; // cells that touch the maze but are not in it yet
+    };
+
+    class WilsonAlgorithm : public MazeAlgorithm {
+    public:
+        Algorithm Id() const override { return Algorithm::Wilson; }
+        void Carve(Grid& grid, const CellRegion& region, Rng& rng) override;
+        void Reserve(const CellRegion& region) override;
+
+    private:
+        std::vector<std::uint8_t> m_Walk; // per cell: in the tree, or the direction the current walk left it by
+    };
+
+    // ***********************************
+    // REGISTRY
+    // ***********************************
+
+    std::unique_ptr<MazeAlgorithm> CreateAlgorithm(Algorithm id);
+
+    const char* AlgorithmName(Algorithm id); // lower case name, e.g. "kruskal"
+
+    bool ParseAlgorithm(const std::string& name, Algorithm& out); // accepts the names from AlgorithmName
+
+}
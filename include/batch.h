@@ -0,0 +1,65 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: batch.h
+ * Description:
+ * Declares the non-interactive batch mode - generates many mazes on all cores
+ * and writes them to a directory or a single archive file.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "algorithm.h"
+#include "rng.h"
+#include "solver.h"
+#include <cstdint>
+#include <string>
+
+namespace MazeGen {
+
+    struct BatchOptions {
+        size_t count = 1;                          // number of mazes to generate
+        int width = 15, height = 9;                // rounded up to odd numbers like SetDimensions does
+        std::uint64_t seed = 0;                    // maze i always gets the same seed derived from (seed, i)
+        bool hasSeed = false;                      // false = pick a random seed for the whole batch
+        Algorithm algorithm = Algorithm::Backtracker;
+        RngKind rng = RngKind::MersenneTwister;
+        std::string outDir = "mazes";              // one file per maze: <outDir>/maze_000000.maze
+        std::string archive;                       // if set, all mazes go into this one file instead
+        int threads = 0;                           // 0 = one per hardware thread
+        bool compress = false;                     // LZ compress each maze record
+        bool legacy = false;                       // write the old one-byte-per-cell format instead of the binary one
+        bool solve = false;                        // solve every maze and fail the batch if one has no path
+        SolveMethod solveMethod = SolveMethod::Bfs;
+    };
+
+    /* Batch Mode
+
+        Every worker thread owns one MazeGenerator and calls GenerateSeeded on it over and over,
+        so the grid and algorithm buffers are reused from maze to maze and nothing is ever
+        displayed. Maze i is generated from a seed derived from (seed, i), which makes every
+        maze reproducible on its own, independent of the thread count.
+
+        Files use the binary save format (see maze_io.h), or the legacy one with --legacy, so any of
+        them can be loaded from the menu. An archive is simply every maze record written back to back,
+        in index order.
+    */
+
+    // Reads the integer that follows the option at argv[i], e.g. "--count 100", and steps i over it.
+    // Shared by the command line modes.
+    bool ReadNumberArg(int argc, char* argv[], int& i, long long& value, std::string& error);
+
+    // Parses the arguments that follow "batch" on the command line. On failure error holds the reason.
+    bool ParseBatchArgs(int argc, char* argv[], int first, BatchOptions& options, std::string& error);
+
+    int RunBatch(const BatchOptions& options); // returns the process exit code
+
+}
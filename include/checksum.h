@@ -0,0 +1,28 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: checksum.h
+ * Description:
+ * Declares the CRC-32 checksum used by the binary file format and exporters.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace MazeGen {
+
+    // Standard CRC-32 (the one used by zip, gzip and PNG). To checksum data in pieces, pass the
+    // previous result as crc: Crc32(b, nb, Crc32(a, na)) == Crc32(ab, na + nb).
+    std::uint32_t Crc32(const void* data, size_t size, std::uint32_t crc = 0);
+
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: chunked.h
+ * Description:
+ * Declares ChunkedMaze - an unbounded maze made of chunks that are generated
+ * on demand and kept in a fixed-size LRU cache.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "algorithm.h" // Used for the algorithm that carves each chunk
+#include "grid.h"
+#include "rng.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace MazeGen {
+
+    /* Infinite Maze (Chunks)
+
+        The plane is cut into square chunks of chunkCells x chunkCells cells. Chunk (cx, cy) covers
+        global grid columns 2 * chunkCells * cx to 2 * chunkCells * (cx + 1), and the same for rows,
+        so two neighbouring chunks share their border wall line:
+
+            grid x:  0        2n       4n        (n = chunkCells)
+                     #########=########
+                     # chunk  # chunk #      column 2n is the right border of chunk 0
+                     # (0, 0) # (1, 0)#      and the left border of chunk 1
+                     #########=########
+
+        Every chunk is carved on its own by one of the usual algorithms, seeded from (seed, cx, cy).
+        The shared borders are decided by the edge, not by either chunk: every border between two
+        chunks gets exactly one opening, at a cell picked from a hash of (seed, edge). Both chunks
+        compute the same opening, so they always fit together, whichever of them is generated first
+        or how often they are evicted and generated again.
+
+        Inside a chunk the maze is perfect. Since every chunk opens to all four neighbours, the
+        plane is connected everywhere, with loops only at chunk scale (around chunk corners).
+
+        Only chunks that are asked for are generated. They live in an LRU cache of at most
+        maxChunks entries: a hash map finds a chunk in O(1) and a list keeps them in order of last
+        use. When the cache is full the least recently used chunk is evicted and its grid buffer is
+        reused for the new one, so memory stays the same however far the viewer travels.
+    */
+    class ChunkedMaze {
+    public:
+        ChunkedMaze(std::uint64_t seed, int chunkCells = 32, size_t maxChunks = 64,
+                    Algorithm algorithm = Algorithm::Backtracker, RngKind rngKind = RngKind::Xoshiro);
+
+        std::uint64_t Seed() const { return m_Seed; }
+        int ChunkCells() const { return m_ChunkCells; }
+        int ChunkStride() const { return 2 * m_ChunkCells; } // grid columns (and rows) from one chunk to the next
+        size_t MaxChunks() const { return m_MaxChunks; }
+        size_t CachedChunks() const { return m_Chunks.size(); }
+        std::uint64_t GeneratedChunks() const { return m_Generated; } // generations so far, including regenerations after eviction
+
+        // Wall at a global grid position. Cells sit at odd coordinates like in a Maze. Generates the chunk if needed.
+        bool IsWall(std::int64_t x, std::int64_t y);
+
+        // The grid of chunk (cx, cy), (2 * chunkCells + 1) squared. Valid until the next call that generates a chunk.
+        const Grid& Chunk(std::int64_t cx, std::int64_t cy);
+
+        // Copies the width x height window starting at global grid position (x, y) into out
+        void CopyWindow(std::int64_t x, std::int64_t y, int width, int height, Grid& out);
+
+    private:
+        struct Entry {
+            std::int64_t cx, cy;
+            Grid grid;
+        };
+
+        struct KeyHash {
+            size_t operator()(const std::pair<std::int64_t, std::int64_t>& key) const;
+        };
+
+        using List = std::list<Entry>;
+
+        Entry& lookup(std::int64_t cx, std::int64_t cy); // from the cache, or generated into it
+
+        void generate(Entry& entry);
+
+        int edgeOpening(std::uint64_t tag, std::int64_t ex, std::int64_t ey) const; // cell of the opening in one border
+
+        std::uint64_t m_Seed;
+        int m_ChunkCells;
+        size_t m_MaxChunks;
+        Algorithm m_Algorithm;
+        RngKind m_RngKind;
+        std::unique_ptr<MazeAlgorithm> m_Engine; // kept so its buffers are reused from chunk to chunk
+
+        List m_Chunks; // most recently used first
+        std::unordered_map<std::pair<std::int64_t, std::int64_t>, List::iterator, KeyHash> m_Index;
+        std::uint64_t m_Generated = 0;
+    };
+
+}
@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: compress.h
+ * Description:
+ * Declares a small, fast LZ77 block compressor used by the binary file format.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MazeGen {
+
+    /* LZ Block Compression
+
+        An LZ77 codec in the spirit of LZ4: the data is a list of sequences, each one some literal
+        bytes followed by a match - "copy length bytes from offset bytes back". Repeated row
+        patterns (long wall runs, identical rows) turn into short matches.
+
+        Sequence layout:
+            token        high 4 bits = literal count, low 4 bits = match length - 4 (15 = more follows)
+            [extra]      literal count extension: bytes of 255 until one below 255, all added up
+            literals
+            offset       2 bytes, little-endian, 1 to 65535 (absent in the last sequence)
+            [extra]      match length extension, same scheme
+
+        The block is self contained; the decompressor needs to know the original size.
+    */
+
+    // Appends the compressed form of data to out (out is cleared first)
+    void CompressBlock(const std::uint8_t* data, size_t size, std::vector<std::uint8_t>& out);
+
+    // Decompresses exactly outSize bytes into out. Returns false on damaged or mismatched input.
+    bool DecompressBlock(const std::uint8_t* data, size_t size, std::uint8_t* out, size_t outSize);
+
+}
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: deflate.h
+ * Description:
+ * Declares ZlibWriter - a self-contained streaming DEFLATE encoder with zlib
+ * framing, used for the IDAT data of exported PNG images.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MazeGen {
+
+    /* Streaming DEFLATE
+
+        PNG images hold their pixels as a zlib stream (RFC 1950) around DEFLATE data (RFC 1951).
+        The encoder here needs no library and never sees the whole image: bytes go in with Write
+        as they are produced, compressed bytes come out in Output() and can be written away at
+        any time, so memory stays the same for any image size.
+
+        Matches are found LZ77 style with a hash of the next 3 bytes and a short chain of earlier
+        positions with the same hash, inside the 32 KB window DEFLATE allows. The data is held in a
+        128 KB buffer that slides forward, keeping the last 32 KB as history.
+
+        Blocks
+            Literals and matches are collected for up to 32K symbols and then written as one block,
+            with Huffman codes built from that block's own symbol counts (a "dynamic" block). Maze
+            rows use very few distinct bytes - in a cell row every other pixel is always a passage -
+            so those codes are much shorter than the standard's fixed 8 and 9 bit literals. Whichever
+            of the two costs fewer bits is used, so tiny images do not pay for a code table.
+
+        Finish writes the last block and the Adler-32 checksum of the uncompressed data.
+    */
+    class ZlibWriter {
+    public:
+        ZlibWriter();
+
+        void Write(const std::uint8_t* data, size_t size);
+
+        void Finish(); // compresses what is left and ends the stream - Write must not be called afterwards
+
+        // Compressed bytes so far. Take them out whenever convenient (e.g. clear() after writing them).
+        std::vector<std::uint8_t>& Output() { return m_Out; }
+
+    private:
+        void compress(bool flush); // codes buffered bytes, all of them when flush is set
+
+        void slide(); // drops history older than the window to make room in the buffer
+
+        size_t findMatch(std::uint64_t pos, size_t available, std::uint64_t& distance) const;
+
+        void insertHash(std::uint64_t pos);
+
+        void putBits(std::uint32_t value, int count) {
+            m_BitBuffer |= static_cast<std::uint64_t>(value) << m_BitCount;
+            m_BitCount += count;
+            if (m_BitCount >= 32) {
+                for (int i = 0; i < 4; i++) m_Out.push_back(static_cast<std::uint8_t>(m_BitBuffer >> (8 * i)));
+                m_BitBuffer >>= 32;
+                m_BitCount -= 32;
+            }
+        }
+
+        void addLiteral(std::uint8_t value);
+
+        void addMatch(size_t length, std::uint64_t distance);
+
+        void writeBlock(bool final); // codes the collected symbols as one block and starts the next
+
+        std::vector<std::uint8_t> m_Buffer; // window history followed by bytes not coded yet
+        std::uint64_t m_Base = 0;           // stream position of m_Buffer[0]
+        std::uint64_t m_Pos = 0;            // next stream position to code
+        std::uint64_t m_End = 0;            // stream position after the last byte written
+
+        std::vector<std::int64_t> m_Head; // per hash: latest position with that hash, -1 = none
+        std::vector<std::int64_t> m_Prev; // per position (mod window): earlier position with the same hash
+
+        // Symbols of the current block: a literal byte, or (distance << 9) | length for a match
+        std::vector<std::uint32_t> m_Symbols;
+        std::vector<std::uint32_t> m_LiteralCounts;  // per literal/length symbol (0-285) in this block
+        std::vector<std::uint32_t> m_DistanceCounts; // per distance symbol (0-29) in this block
+
+        std::uint32_t m_AdlerA = 1, m_AdlerB = 0;
+        std::uint64_t m_BitBuffer = 0;
+        int m_BitCount = 0;
+        bool m_Finished = false;
+        std::vector<std::uint8_t> m_Out;
+    };
+
+}
@@ -2,7 +2,7 @@
  * Project: Maze Generator - Console App
  * File: driver.h
  * Description:
- * Header file for driver.cpp. Declares function for running program.
+ * Header file for driver.cpp. Declares functions for running program.
  *
  * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
  *
@@ -12,13 +12,15 @@
  * Version: v1.0.0
  * Author: Ghost
  * Created On: 02-14-2025
- * Last Modified: 02-14-2025
+ * Last Modified: 10-17-2026
  *****************************************************************************/
 
 #pragma once
   
 namespace MazeGen {
 
-    int run();
+    int run(); // interactive menu
+
+    int runCommandLine(int argc, char* argv[]); // non-interactive modes, e.g. "MazeGen batch --count 100"
 
 }
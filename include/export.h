@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: export.h
+ * Description:
+ * Declares exporting mazes to image formats (PBM, PNG) and graph formats
+ * (edge list, CSR adjacency arrays).
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "grid.h"
+#include "result.h" // Used for the error codes of ExportMaze
+#include <cstdio>
+#include <string>
+
+namespace MazeGen {
+
+    static const int kMaxExportScale = 64; // largest number of pixels per grid position in an image
+
+    enum class ExportFormat {
+        Pbm,      // binary portable bitmap (P4) - one bit per pixel, walls black
+        Png,      // 1-bit greyscale PNG, walls black, compressed by the built-in encoder (deflate.h)
+        EdgeList, // text - one "a b" line per open wall between two cells
+        Csr,      // binary compressed sparse row arrays (layout below)
+        Count
+    };
+
+    const char* ExportFormatName(ExportFormat format); // "pbm", "png", "edges" or "csr" - also the file extension
+
+    bool ParseExportFormat(const std::string& name, ExportFormat& out); // accepts the names from ExportFormatName
+
+    // Picks the format from the extension of filename (.pbm, .png, .edges / .txt, .csr)
+    bool ExportFormatFromFilename(const std::string& filename, ExportFormat& out);
+
+    /* Streaming Export
+
+        Every format is written while walking the grid row by row - no image, graph or adjacency
+        list is ever built in memory. Image rows are packed into one row buffer and written (PBM)
+        or pushed through the streaming DEFLATE encoder (PNG), graph formats go through a 64 KB
+        output buffer. Memory depends only on the width of one row (times the scale), never on
+        the height, and a memory-mapped maze (LoadMode::Map) is read straight from the page cache.
+
+        Images
+            One pixel per grid position, or scale x scale pixels with scale > 1. Walls are black,
+            passages white. The scale is 1 to kMaxExportScale (a scale below 1 counts as 1, above
+            it is refused with TooLarge), and neither side of the image may pass 2^31 - 1 pixels
+            (TooLarge) - so the one row buffer stays at most kMaxExportScale times a grid row.
+
+        Graphs
+            Nodes are the maze cells (odd x, odd y), numbered row by row: cell (cx, cy) at grid
+            position (2 * cx + 1, 2 * cy + 1) is node cy * cols + cx. Two neighbouring cells are
+            joined by an edge when the wall between them is open. The entrance and exit are the
+            cells next to the openings in the top and bottom border rows.
+
+            Edge list - a text header, then one edge per line with the smaller node first:
+                # mazegen edge list
+                # cols 7 rows 4 nodes 28 edges 27 entrance 0 exit 24
+                0 1
+                0 7
+                ...
+
+            CSR - little-endian binary, every node's neighbours in ascending order:
+                offset  size          field
+                0       4             magic "MCSR"
+                4       4             version (1)
+                8       4             cols
+                12      4             rows
+                16      8             node count n
+                24      8             neighbour entries m (twice the edge count)
+                32      8             entrance node (~0 = none)
+                40      8             exit node (~0 = none)
+                48      4 * (n + 1)   offsets - node i's neighbours are entries offsets[i] to offsets[i + 1]
+                ...     4 * m         neighbours
+            The grid is walked three times (count, offsets, neighbours) so nothing has to be stored.
+            Node numbers and offsets are 32 bits - a maze with 2^31 cells or more is refused (TooLarge).
+    */
+    MazeError ExportGrid(std::FILE* out, const Grid& grid, ExportFormat format, int scale = 1);
+
+    // Writes to filename under a temporary name first, like SaveMazeFile
+    MazeError ExportGrid(const std::string& filename, const Grid& grid, ExportFormat format, int scale = 1);
+
+}
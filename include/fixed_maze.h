@@ -0,0 +1,245 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: fixed_maze.h
+ * Description:
+ * Declares FixedMazeGenerator<W, H> - a backtracking generator specialised at
+ * compile time for one maze size, with fixed-size arrays instead of vectors.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "grid.h"
+#include "maze.h"
+#include "result.h" // Used for MazeError and Result<Maze>
+#include "rng.h"
+#include <array>
+#include <cstdint>
+#include <cstring>  // Used for std::memcpy() into a Grid
+#include <random>   // Used for std::random_device to pick fresh seeds
+#include <utility>  // Used for std::swap()
+
+namespace MazeGen {
+
+    /* Fixed Size Generator
+
+        Most levels come in a handful of sizes (31x31, 63x63, ...). For those the size can be a
+        template argument instead of a run time value, and everything that depends on it is worked
+        out by the compiler:
+
+            - the grid is a std::array of words inside the object, rows padded exactly like Grid
+            - the carving stack and the visited cells are std::arrays too - nothing is ever allocated
+            - the all-walls grid and the empty visited array are constexpr tables, copied in one go
+
+        Sentinel Border
+            The dynamic backtracker checks every move against the region's edges. Here the visited
+            array has one extra ring of cells around the maze that is marked visited from the start:
+
+                S S S S S      S = sentinel (always visited)
+                S c c c S      c = maze cell
+                S c c c S
+                S S S S S
+
+            A move off the maze lands on a sentinel and is refused by the same "already visited?"
+            test as any other move, so there is no bounds branch at all. The four neighbour offsets
+            (up, down, left, right) are constants of the array's row stride.
+
+        Same Mazes
+            Cells are visited in the same order and every random number is drawn exactly like in
+            BacktrackerAlgorithm and MazeGenerator (same shuffle, same entrance and exit pick), so a
+            seed gives the very same maze as MazeGenerator with Algorithm::Backtracker at W x H, at any
+            thread count. That holds up to one tile (W and H up to 1025, see parallel.h) - MazeGenerator
+            tiles bigger mazes, which this class never does.
+            Create and CopyTo hand it over as an ordinary Maze for displaying, saving and solving.
+
+        Everything lives inside the object (about W * H / 4 bytes for the stack and the visited
+        cells), so for the bigger sizes create it on the heap rather than on a small thread stack.
+    */
+    template <int W, int H>
+    class FixedMazeGenerator {
+        static_assert(W >= 3 && H >= 3 && W % 2 == 1 && H % 2 == 1, "fixed mazes need odd sizes of at least 3");
+        static_assert(W < 32768 && H < 32768, "grid positions are stored in 16 bits");
+
+    public:
+        static constexpr int kWidth = W;
+        static constexpr int kHeight = H;
+        static constexpr int kCols = (W - 1) / 2; // cells per row
+        static constexpr int kRows = (H - 1) / 2;
+        static constexpr size_t kWordsPerRow = (static_cast<size_t>(W) + Grid::kWordBits - 1) / Grid::kWordBits;
+
+        using Words = std::array<Grid::Word, kWordsPerRow * H>;
+
+        FixedMazeGenerator() : m_RNG(std::random_device{}()) {}
+
+        // Same seeding rules as MazeGenerator
+        void SetSeed(std::uint64_t seed) { m_FixedSeed = seed; m_HasFixedSeed = true; }
+        void ClearSeed() { m_HasFixedSeed = false; }
+        bool HasFixedSeed() const { return m_HasFixedSeed; }
+        std::uint64_t GetSeed() const { return m_RNG.GetSeed(); }
+
+        void SetRngKind(RngKind kind) { m_RNG.Reset(m_RNG.GetSeed(), kind); }
+        RngKind GetRngKind() const { return m_RNG.Kind(); }
+
+        Algorithm GetAlgorithm() const { return Algorithm::Backtracker; } // the only algorithm with a fixed size path
+
+        MazeError Generate() { return GenerateSeeded(nextSeed()); }
+
+        MazeError GenerateSeeded(std::uint64_t seed) {
+            m_RNG.Seed(seed);
+            m_Words = kAllWalls;
+            carve();
+            addEntranceAndExit();
+            m_HasMaze = true;
+            return MazeError::None;
+        }
+
+        // Generates a maze and hands it over as an ordinary Maze
+        Result<Maze> Create() { return Create(nextSeed()); }
+
+        Result<Maze> Create(std::uint64_t seed) {
+            GenerateSeeded(seed);
+            Maze maze;
+            CopyTo(maze);
+            return maze;
+        }
+
+        // Copies the current maze into maze - reuses its grid buffer, like MazeGenerator::Generate does
+        MazeError CopyTo(Maze& maze) const {
+            if (!m_HasMaze) return MazeError::NoMaze;
+            maze.m_Width = W;
+            maze.m_Height = H;
+            maze.m_Name = "Unnamed";
+            maze.m_Algorithm = Algorithm::Backtracker;
+            maze.m_RngKind = m_RNG.Kind();
+            maze.m_Seed = m_RNG.GetSeed();
+            maze.m_Grid.Assign(W, H, true);
+            std::memcpy(maze.m_Grid.Data(), m_Words.data(), sizeof(Words)); // same row layout as Grid
+            return MazeError::None;
+        }
+
+        bool HasMaze() const { return m_HasMaze; }
+
+        bool IsWall(int x, int y) const {
+            return (m_Words[static_cast<size_t>(y) * kWordsPerRow + x / Grid::kWordBits] >> (x % Grid::kWordBits)) & 1u;
+        }
+
+        const Words& GetWords() const { return m_Words; } // the packed rows, laid out like Grid::Data()
+
+    private:
+        // Visited cells with the sentinel ring - cell (cx, cy) is at (cy + 1) * kStride + cx + 1
+        static constexpr int kStride = kCols + 2;
+        static constexpr size_t kVisitedSize = static_cast<size_t>(kStride) * (kRows + 2);
+
+        using Visited = std::array<std::uint8_t, kVisitedSize>;
+
+        // Up, down, left and right, in the order of BacktrackerAlgorithm's dx/dy tables
+        static constexpr int kCellStep[4] = { -kStride, kStride, -1, 1 }; // in the visited array
+        static constexpr int kGridDX[4] = { 0, 0, -1, 1 };                // to the wall between two cells
+        static constexpr int kGridDY[4] = { -1, 1, 0, 0 };
+
+        struct Frame {
+            std::int32_t cell;                // index into the visited array
+            std::int16_t x, y;                // grid position of the cell
+            std::array<std::uint8_t, 4> dirs; // this cell's own shuffled direction order
+            std::uint8_t next;                // index into dirs of the next direction to try (4 = done)
+        };
+
+        static constexpr Words makeAllWalls() {
+            Words words{};
+            const int tailBits = W % Grid::kWordBits;
+            for (int y = 0; y < H; y++) {
+                for (size_t w = 0; w < kWordsPerRow; w++) {
+                    const bool last = w + 1 == kWordsPerRow && tailBits != 0;
+                    words[y * kWordsPerRow + w] = last ? (Grid::Word(1) << tailBits) - 1 : ~Grid::Word(0); // padding bits stay 0
+                }
+            }
+            return words;
+        }
+
+        static constexpr Visited makeUnvisited() {
+            Visited visited{};
+            for (int y = 0; y < kRows + 2; y++) {
+                for (int x = 0; x < kStride; x++) {
+                    visited[y * kStride + x] = (x == 0 || y == 0 || x == kStride - 1 || y == kRows + 1) ? 1 : 0;
+                }
+            }
+            return visited;
+        }
+
+        static constexpr Words kAllWalls = makeAllWalls();
+        static constexpr Visited kUnvisited = makeUnvisited();
+
+        void setPassage(int x, int y) {
+            m_Words[static_cast<size_t>(y) * kWordsPerRow + x / Grid::kWordBits] &= ~(Grid::Word(1) << (x % Grid::kWordBits));
+        }
+
+        void carve() {
+            m_Visited = kUnvisited;
+            size_t depth = 0;
+
+            auto push = [&](int cell, int x, int y) {
+                m_Visited[cell] = 1;
+                setPassage(x, y);
+                Frame& frame = m_Stack[depth++]; // the stack holds one frame per cell, it cannot overflow
+                frame.cell = cell;
+                frame.x = static_cast<std::int16_t>(x);
+                frame.y = static_cast<std::int16_t>(y);
+                frame.dirs = { 0, 1, 2, 3 };
+                frame.next = 0;
+                // Rng::Shuffle unrolled for 4 entries - the same draws in the same order, without its loop and range checks
+                std::swap(frame.dirs[3], frame.dirs[m_RNG.Bounded(4)]);
+                std::swap(frame.dirs[2], frame.dirs[m_RNG.Bounded(3)]);
+                std::swap(frame.dirs[1], frame.dirs[m_RNG.Bounded(2)]);
+            };
+
+            push(kStride + 1, 1, 1); // top left cell, like the dynamic backtracker
+
+            while (depth > 0) {
+                Frame& frame = m_Stack[depth - 1];
+                if (frame.next == 4) {
+                    depth--;
+                    continue;
+                }
+
+                const int dir = frame.dirs[frame.next++];
+                const int cell = frame.cell + kCellStep[dir];
+                if (m_Visited[cell]) continue; // visited, or a sentinel outside the maze
+
+                const int wallX = frame.x + kGridDX[dir], wallY = frame.y + kGridDY[dir];
+                setPassage(wallX, wallY);
+                push(cell, wallX + kGridDX[dir], wallY + kGridDY[dir]);
+            }
+        }
+
+        void addEntranceAndExit() {
+            // Every cell is open after carving, so the first open cell of the top row is always x = 1
+            // and the exit is the n-th cell of the bottom row - the same picks MazeGenerator makes
+            setPassage(1, 0);
+            const int exitCell = static_cast<int>(m_RNG.Bounded(static_cast<std::uint32_t>(kCols)));
+            setPassage(2 * exitCell + 1, H - 1);
+        }
+
+        std::uint64_t nextSeed() const {
+            if (m_HasFixedSeed) return m_FixedSeed;
+            std::random_device device;
+            return (static_cast<std::uint64_t>(device()) << 32) | device();
+        }
+
+        Words m_Words{};
+        Visited m_Visited{};
+        std::array<Frame, static_cast<size_t>(kCols) * kRows> m_Stack{};
+        Rng m_RNG;
+        std::uint64_t m_FixedSeed = 0;
+        bool m_HasFixedSeed = false;
+        bool m_HasMaze = false;
+    };
+
+}
@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: grid.h
+ * Description:
+ * Declares the Grid class - a flat, bit-packed storage for maze walls and passages.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstdint> // Used for fixed size words (std::uint64_t)
+#include <cstddef>
+#include <memory>  // Used for std::shared_ptr keeping external storage alive
+#include <vector>
+
+namespace MazeGen {
+
+    /* Bit-Packed Grid
+
+        A maze cell is either a wall or a passage, so one bit is enough to store it. The old
+        std::vector<std::vector<char>> used 8 bits per cell plus one heap allocation per row.
+
+        The Grid stores every row as a run of 64-bit words, one after the other in a single
+        contiguous buffer (row-major). Bit x % 64 of word x / 64 in a row holds cell x:
+            1 = wall ('#'), 0 = passage (' ')
+
+        Rows are padded up to a full word and the padding bits are always kept at 0, which lets
+        whole-row operations (counting, copying, comparing) work on words without masking.
+
+        External Storage
+            Normally the grid owns its words. Adopt lets it use words that live somewhere else
+            instead - a memory-mapped save file (see mapped_file.h) - so a huge maze can be shown
+            and queried without copying it. The storage handle passed to Adopt is kept alive for
+            as long as the grid points into it. Assign and Clear switch back to owned storage.
+    */
+    class Grid {
+    public:
+        using Word = std::uint64_t;
+        static constexpr int kWordBits = 64;
+
+        static constexpr char kWall = '#';
+        static constexpr char kPassage = ' ';
+
+        Grid() : m_Width(0), m_Height(0), m_WordsPerRow(0), m_Data(nullptr) {}
+        Grid(int w, int h, bool walls = true) : Grid() { Assign(w, h, walls); }
+
+        // Copying an externally stored grid copies its words into owned storage; moving keeps the storage
+        Grid(const Grid& other);
+        Grid(Grid&& other) noexcept;
+        Grid& operator=(const Grid& other);
+        Grid& operator=(Grid&& other) noexcept;
+
+        // Resizes the grid and fills every cell with walls (or passages). Keeps the buffer capacity if it can.
+        void Assign(int w, int h, bool walls = true);
+
+        // Makes room for a w x h grid without changing this one, so a later Assign up to that size does not allocate
+        void Reserve(int w, int h);
+
+        // Releases all memory and goes back to an empty 0x0 grid
+        void Clear();
+
+        // Uses w x h cells stored at words (laid out exactly like the grid's own buffer, padding bits 0)
+        // without copying them. storage owns the words and is released together with the grid.
+        void Adopt(int w, int h, Word* words, std::shared_ptr<void> storage);
+
+        bool IsExternal() const { return m_Storage != nullptr; }
+
+        int Width() const { return m_Width; }
+        int Height() const { return m_Height; }
+        bool Empty() const { return m_Width == 0 || m_Height == 0; }
+
+        size_t WordsPerRow() const { return m_WordsPerRow; }
+        size_t WordCount() const { return m_WordsPerRow * static_cast<size_t>(m_Height); }
+        size_t ByteSize() const { return WordCount() * sizeof(Word); } // memory used by the cells
+
+        // Raw access to the packed words, used by file I/O and bulk row operations
+        Word* Row(int y) { return m_Data + static_cast<size_t>(y) * m_WordsPerRow; }
+        const Word* Row(int y) const { return m_Data + static_cast<size_t>(y) * m_WordsPerRow; }
+        Word* Data() { return m_Data; }
+        const Word* Data() const { return m_Data; }
+
+        bool IsWall(int x, int y) const {
+            return (Row(y)[x / kWordBits] >> (x % kWordBits)) & 1u;
+        }
+
+        void SetWall(int x, int y) {
+            Row(y)[x / kWordBits] |= Word(1) << (x % kWordBits);
+        }
+
+        void SetPassage(int x, int y) {
+            Row(y)[x / kWordBits] &= ~(Word(1) << (x % kWordBits));
+        }
+
+        // Character helpers so code that thinks in '#' and ' ' still reads naturally
+        char At(int x, int y) const { return IsWall(x, y) ? kWall : kPassage; }
+        void Set(int x, int y, char c) { (c == kPassage) ? SetPassage(x, y) : SetWall(x, y); }
+
+        // Converts one row to/from its printable form ('#' and ' '), out/in must hold Width() chars
+        void RowToChars(int y, char* out) const { RowToChars(y, 0, m_Width, out); }
+
+        // Converts count cells of row y starting at x. Fastest when x is a multiple of 8 (whole packed bytes).
+        void RowToChars(int y, int x, int count, char* out) const;
+
+        void RowFromChars(int y, const char* in);
+
+    private:
+        int m_Width, m_Height;
+        size_t m_WordsPerRow;
+        std::vector<Word> m_Words; // all rows back to back (unused while the storage is external)
+        Word* m_Data;              // m_Words.data() or the adopted words
+        std::shared_ptr<void> m_Storage; // keeps adopted words alive, null when the grid owns its words
+    };
+}
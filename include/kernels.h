@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: kernels.h
+ * Description:
+ * Declares bit-parallel analysis kernels that work on the packed grid words -
+ * wall counts, dead-end masks, exit scans and flood fill.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "grid.h"
+#include <cstddef>
+
+namespace MazeGen {
+
+    /* Bit-Parallel Kernels
+
+        A Grid word holds 64 cells, so one machine instruction can answer a question for 64
+        cells at once: a popcount counts 64 walls, a shift lines up 64 cells with their left or
+        right neighbours, and AND/OR combine 64 neighbour tests. The kernels below never look
+        at a single cell unless they have to.
+
+        Kernel Levels
+            The same kernels exist in several builds, and the fastest one the CPU supports is
+            picked once at start up:
+                Scalar - plain C++, works everywhere
+                Popcnt - the scalar code compiled with the hardware popcount instruction
+                Avx2   - 256-bit vectors, four words per instruction
+            The vector builds are only compiled with GCC/Clang on x86. Everything else always
+            uses the scalar kernels.
+    */
+    enum class KernelLevel {
+        Scalar,
+        Popcnt,
+        Avx2,
+        Count
+    };
+
+    const char* KernelLevelName(KernelLevel level); // "scalar", "popcnt" or "avx2"
+
+    KernelLevel BestKernelLevel();   // the fastest level this CPU supports
+    KernelLevel ActiveKernelLevel(); // the level the kernels currently use
+
+    // Switches the kernels to another level, e.g. to compare them. Fails if the CPU (or build) does not support it.
+    bool SetKernelLevel(KernelLevel level);
+
+    // ***********************************
+    // COUNTS
+    // ***********************************
+
+    size_t CountWalls(const Grid& grid);
+
+    double PassageRatio(const Grid& grid); // passages / all cells, 0 for an empty grid
+
+    /* Dead Ends
+        A dead end is a maze cell (odd x, odd y - see CellRegion in algorithm.h) that is open and
+        has walls on exactly three of its four sides. For a whole row of cells that is:
+            open & exactlyThree(up row, down row, row shifted left, row shifted right)
+        which is a handful of word operations per 64 grid positions.
+    */
+    size_t CountDeadEnds(const Grid& grid);
+
+    void DeadEndMask(const Grid& grid, Grid& out); // out gets the size of grid and a bit set on every dead end
+
+    // ***********************************
+    // ROW SCANS
+    // ***********************************
+
+    // Number of open cells (odd x) in row y
+    size_t CountOpenCells(const Grid& grid, int y);
+
+    // x of the n-th open cell (odd x, counting from 0) in row y, or -1 if the row has fewer
+    int NthOpenCell(const Grid& grid, int y, size_t n);
+
+    // ***********************************
+    // FLOOD FILL
+    // ***********************************
+
+    /* Bit-Parallel Flood Fill
+        Finds every passage reachable from (x, y) moving up, down, left and right. reach gets the
+        size of grid with a bit set on every reachable position; the return value is their count
+        (0 if (x, y) is a wall or outside the grid).
+
+        Instead of visiting positions one at a time, the fill works on whole words: inside a word
+        a reached bit spreads along its run of passages with a few shift-and-mask steps, and a
+        word only goes back on the work list when a neighbouring word gave it new bits.
+    */
+    size_t FloodFill(const Grid& grid, int x, int y, Grid& reach);
+
+}
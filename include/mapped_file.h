@@ -0,0 +1,71 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: mapped_file.h
+ * Description:
+ * Declares MappedFile - a memory-mapped view of a whole file.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace MazeGen {
+
+    /* Memory-Mapped Files
+
+        Reading a file copies it from the operating system's cache into our own buffer. Mapping
+        it instead makes the file's pages appear directly in our address space: opening is
+        instant whatever the size, and a page is only read from disk the first time it is
+        touched. A huge maze of which only a corner is looked at never loads the rest.
+
+        The mapping is private (copy-on-write): the bytes can be written to, but changes stay in
+        this process and never reach the file. That lets a Grid adopt the mapped words as its
+        own and still carve or edit them later.
+
+        The mapping is released when the MappedFile is destroyed. It can be moved, not copied.
+
+        On POSIX systems a mapped file can be renamed over or deleted and the mapping keeps the old
+        contents. Windows shares the file for reading and deleting, but still refuses to replace it
+        while the view is mapped (see ReplaceFile in maze_io.h).
+    */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile() { Close(); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept { *this = static_cast<MappedFile&&>(other); }
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        // Maps the whole file. Fails for missing and empty files.
+        bool Open(const std::string& filename);
+
+        void Close();
+
+        bool IsOpen() const { return m_Data != nullptr; }
+        std::uint8_t* Data() { return m_Data; }
+        const std::uint8_t* Data() const { return m_Data; }
+        size_t Size() const { return m_Size; }
+
+    private:
+        std::uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+#ifdef _WIN32
+        void* m_File = nullptr;    // HANDLE of the open file
+        void* m_Mapping = nullptr; // HANDLE of the file mapping object
+#endif
+    };
+
+}
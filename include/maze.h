@@ -12,21 +12,30 @@
  * Version: v1.0.0
  * Author: Ghost
  * Created On: 02-14-2025
- * Last Modified: 02-14-2025
+ * Last Modified: 10-17-2026
  *****************************************************************************/
 
 #pragma once
-#include <vector>  // Used for creating the maze grid as a 2D matrix (std::vector)
-#include <string>  
+#include "grid.h"      // Flat, bit-packed grid used to store the maze
+#include "algorithm.h" // Used to record which algorithm made the maze
+#include <cstdint>
+#include <string>
 
 namespace MazeGen {
     struct Maze {
         int m_Width, m_Height; // stores the maze, grid dimensions
-        std::vector<std::vector<char>> m_Grid; // stores all pathways and walls of the maze as character '#' (wall) or ' ' (passage)
+        Grid m_Grid; // stores all pathways and walls of the maze, one bit per cell - wall ('#') or passage (' ')
         std::string m_Name; // track name of maze for file i/o
 
-        Maze() : m_Width(0), m_Height(0), m_Name("Unnamed") {} // default constructor
-        Maze(int w, int h) : m_Width(w), m_Height(h), m_Name("Unnamed") {}
+        // How the maze was made - saved in the binary file header so a maze can be recreated from its file
+        Algorithm m_Algorithm;
+        RngKind m_RngKind;
+        std::uint64_t m_Seed;
+
+        Maze() : m_Width(0), m_Height(0), m_Name("Unnamed"),
+                 m_Algorithm(Algorithm::Backtracker), m_RngKind(RngKind::MersenneTwister), m_Seed(0) {} // default constructor
+        Maze(int w, int h) : m_Width(w), m_Height(h), m_Name("Unnamed"),
+                 m_Algorithm(Algorithm::Backtracker), m_RngKind(RngKind::MersenneTwister), m_Seed(0) {}
 
     };
 }
@@ -12,25 +12,60 @@
  * Version: v1.0.0
  * Author: Ghost
  * Created On: 02-14-2025
- * Last Modified: 02-14-2025
+ * Last Modified: 10-17-2026
  *****************************************************************************/
 
 #pragma once
 #include "maze.h"
-#include <iostream>
-#include <random>     // Used for std::mt19937 (Mersenne Twister PRNG) to randomize maze paths
+#include "algorithm.h" // Used for the pluggable generation algorithms
+#include "parallel.h"  // Used for multi-threaded (tiled) generation
+#include <cstdio>
+#include <memory>
+#include "rng.h"      // Used for the seeded random number generator (Mersenne Twister or xoshiro)
+#include "renderer.h" // Used for the Display options
+#include "solver.h"   // Used for solving the current maze
+#include "regenerate.h" // Used for re-carving one region of the current maze
+#include "stats.h"    // Used for the generation statistics
+#include "result.h"   // Used for the error codes returned instead of printed messages
+#include "export.h"   // Used for exporting to image and graph formats
 
 namespace MazeGen {
+
+    /* Maze Generator
+
+        The core of the mazegen library. Nothing here prints on its own - every call that can fail returns
+        a MazeError (or a Result holding the maze) and the program decides what to tell the user. The only
+        output is the one asked for: Display, Solve and StreamToConsole draw the maze.
+    */
     class MazeGenerator {
     private:
         Maze m_CurrentMaze;
         int m_Width, m_Height;
-        std::mt19937 m_RNG; // Mersenne Twister - pseudo-random number generator
+        Rng m_RNG; // pseudo-random number generator - Mersenne Twister unless SetRngKind says otherwise
+        std::uint64_t m_FixedSeed; // seed used by every Generate call while m_HasFixedSeed is true
+        bool m_HasFixedSeed;
 
-        void carveMaze(int x, int y);
+        Algorithm m_Algorithm; // which algorithm Generate uses
+        std::unique_ptr<MazeAlgorithm> m_Engine; // the algorithm object - kept so its buffers are reused
+        int m_Threads; // workers for tiled generation, used by mazes bigger than one tile (see parallel.h)
+        std::unique_ptr<TiledGenerator> m_Tiled; // created by the first maze that is tiled
+        RenderOptions m_RenderOptions; // how Display draws the maze
+        Solver m_Solver;               // kept so its buffers are reused between solves
+        RegionRegenerator m_Regenerator; // kept so its buffers are reused between regenerations
+        Solution m_Solution;           // result of the last Solve
+        Grid m_SolutionOverlay;        // the solution path as grid bits, drawn over the maze
+        mutable GenerationStats m_Stats; // mutable - Display is const but still records how long it took
 
         void addEntranceAndExit();
 
+        MazeError display(const RenderOptions& options, std::FILE* out) const; // Display with any render options
+
+        void generateMaze(std::uint64_t seed); // shared by Generate and GenerateSeeded - never prints
+
+        std::uint64_t nextSeed() const; // the fixed seed, or a fresh random one
+
+        TiledGenerator& tiled(); // creates m_Tiled with m_Threads workers on first use
+
     public:
         
         MazeGenerator(); // default constructor
@@ -39,13 +74,99 @@ namespace MazeGen {
 
         void SetDimensions(int w, int h, bool generate = true); // default value for third arg
 
-        void Generate();
+        void SetAlgorithm(Algorithm algorithm); // used by the next Generate call
+
+        Algorithm GetAlgorithm() const { return m_Algorithm; }
+
+        void SetThreads(int threads); // 0 = all hardware threads, 1 = single threaded
+
+        int GetThreads() const { return m_Threads; }
+
+        /* Workspace
+            The generator keeps everything a generation needs between calls: the grid of the current maze,
+            the algorithm object with its carving stack and scratch buffers, and the tiled generator's worker
+            buffers. They only grow when a maze is bigger than any before, so generating mazes of the same
+            size in a loop does no heap allocations at all after the first one.
+
+            Reserve sizes the workspace up front so not even the first Generate allocates. Call it after
+            SetAlgorithm and SetThreads - a new algorithm or thread count starts with empty buffers - and
+            note that Create hands the grid buffer over with the maze.
+        */
+        void Reserve(int w, int h);
+
+        /* Seeding
+            By default every Generate call picks a fresh random seed. After SetSeed, every call uses that
+            seed instead, so the same (seed, width, height, algorithm, rng kind) always gives the same maze,
+            whatever the thread count - mazes bigger than one tile are always tiled, smaller ones never.
+            GetSeed returns the seed of the current maze either way - a random maze can be recreated later.
+        */
+        void SetSeed(std::uint64_t seed);
+
+        void ClearSeed(); // back to a fresh random seed per maze
+
+        bool HasFixedSeed() const { return m_HasFixedSeed; }
+
+        std::uint64_t GetSeed() const { return m_RNG.GetSeed(); }
+
+        void SetRngKind(RngKind kind); // changes the numbers a seed produces, so mazes differ between kinds
+
+        RngKind GetRngKind() const { return m_RNG.Kind(); }
 
-        void Display() const;
+        // Generates a new current maze with the next seed. Reuses the grid buffer of the previous maze,
+        // which makes it the right call when generating many mazes in a loop.
+        MazeError Generate();
 
-        void SaveToFile(const std::string& filename);
+        MazeError GenerateSeeded(std::uint64_t seed); // same, from the given seed
+
+        // Generates a maze and hands it over by value - the grid is moved out, not copied, and the
+        // generator is left without a current maze. Use Generate and GetMaze to keep it instead.
+        Result<Maze> Create();
+
+        Result<Maze> Create(std::uint64_t seed);
+
+        const Maze& GetMaze() const { return m_CurrentMaze; }
+
+        // Re-randomizes one rectangle of cells of the current maze (region is in cell coordinates, see
+        // CellRegion in algorithm.h) and leaves the rest alone. The maze stays perfect and the cost only
+        // depends on the size of the region (see regenerate.h). Without a seed the next seed is used,
+        // like Generate does - the maze's own seed no longer recreates it afterwards.
+        MazeError RegenerateRegion(const CellRegion& region);
+
+        MazeError RegenerateRegion(const CellRegion& region, std::uint64_t seed);
+
+        void SetMazeName(const std::string& name);
+
+        MazeError Display(std::FILE* out = stdout) const;
+
+        void SetRenderOptions(const RenderOptions& options) { m_RenderOptions = options; }
+
+        const RenderOptions& GetRenderOptions() const { return m_RenderOptions; }
+
+        // Solves the current maze and shows the path on top of it - the solver statistics are in GetSolution.
+        // Returns MazeError::NoSolution if there is no path from the entrance to the exit.
+        MazeError Solve(SolveMethod method, std::FILE* out = stdout);
+
+        const Solution& GetSolution() const { return m_Solution; } // result of the last Solve
+
+        // Timers and counters of the last generation, display, save and load (see stats.h)
+        const GenerationStats& GetStats() const { return m_Stats; }
+
+        // Saves in the binary format (see maze_io.h). compress = LZ compress the packed cells.
+        MazeError SaveToFile(const std::string& filename, bool compress = false);
         
-        bool LoadFromFile(const std::string& filename);
+        // Loads a binary or a legacy save file
+
+        MazeError LoadFromFile(const std::string& filename);
+
+        // Exports the current maze as an image (PBM, PNG) or a graph (edge list, CSR) - see export.h.
+        // scale = pixels per grid position for images, 1 to kMaxExportScale.
+        MazeError ExportToFile(const std::string& filename, ExportFormat format, int scale = 1) const;
+
+        // Generates a maze straight into a file (uncompressed SaveToFile format) or to the console without keeping it in memory.
+        // Always uses Eller's algorithm, since it is the one that works a row at a time (see stream.h).
+        MazeError StreamToFile(const std::string& filename);
+
+        MazeError StreamToConsole();
             
     };
 }
@@ -0,0 +1,140 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: maze_io.h
+ * Description:
+ * Declares reading and writing mazes in the binary save file formats.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "maze.h"
+#include "result.h" // Used for the error codes of the file functions
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace MazeGen {
+
+    /* Legacy Save Format
+
+        The format written by SaveToFile since the first version:
+            size_t  name length
+            char[]  name
+            int     width
+            int     height
+            char[]  width * height cells, row by row ('#' or ' ')
+
+        These functions work on any stream (a file, or a memory buffer) and never print anything,
+        so they can be used from the batch mode as well as from MazeGenerator.
+    */
+    bool WriteLegacyHeader(std::ostream& out, const std::string& name, int width, int height);
+
+    bool WriteLegacyMaze(std::ostream& out, const Maze& maze);
+
+    bool ReadLegacyMaze(std::istream& in, Maze& maze);
+
+    /* Binary Save Format (version 1)
+
+        The legacy format stores one byte per cell in native byte order with no way to tell a
+        damaged file from a good one. The binary format stores the grid exactly as it sits in
+        memory - one bit per cell, rows padded to 64-bit words - behind a fixed size header.
+        Every number is little-endian, whatever machine wrote the file.
+
+            offset  size  field
+            0       4     magic "MAZE"
+            4       2     version (1)
+            6       2     flags - bit 0 set = payload is bit plane filtered and LZ compressed
+            8       4     width
+            12      4     height
+            16      1     algorithm that generated the maze
+            17      1     random number generator kind
+            18      2     reserved (0)
+            20      4     name length
+            24      8     seed
+            32      8     payload offset from the start of the record (multiple of 64)
+            40      8     stored payload size in bytes
+            48      8     unpacked payload size in bytes (words per row * height * 8)
+            56      4     CRC-32 of the stored payload
+            60      4     CRC-32 of header bytes 0-59 followed by the name
+            64      n     name, then zero padding up to the payload offset
+
+        Because the payload starts on a 64 byte boundary, an uncompressed payload can be used
+        in place as the grid's words. A record is self delimiting (payload offset + stored
+        size), so records can also be written back to back into one archive file.
+    */
+    static constexpr std::uint16_t kMazeFormatVersion = 1;
+    static constexpr size_t kMazeHeaderSize = 64;
+
+    // Appends one binary record for maze to out. With compress set the payload is LZ compressed,
+    // unless that would not make it smaller.
+    void EncodeMaze(const Maze& maze, std::vector<std::uint8_t>& out, bool compress = false);
+
+    // For writers that produce the rows themselves (see FileRowSink in stream.h): EncodeMazeHeader replaces out with
+    // the header and name of an uncompressed record for maze's width and height (its grid is not used), padded to
+    // where the payload starts. The rows follow as EncodeRow appends them, and payloadCrc is the CRC-32 of all of
+    // them - a writer that only knows it at the end writes the header again once it does.
+    void EncodeMazeHeader(const Maze& maze, std::uint32_t payloadCrc, std::vector<std::uint8_t>& out);
+
+    void EncodeRow(const Grid& grid, int y, std::vector<std::uint8_t>& out); // appends row y in file byte order
+
+    // Decodes the binary record at the start of data. Returns the size of the record, or 0 if the data
+    // is not a valid record (wrong magic or version, truncated, checksum mismatch).
+    size_t DecodeMaze(const std::uint8_t* data, size_t size, Maze& maze);
+
+    bool IsBinaryMaze(const std::uint8_t* data, size_t size); // true if data starts with the binary magic
+
+    /* Files
+        Both functions do one bulk write/read of the whole file. LoadMazeFile accepts the binary and the
+        legacy format - the binary magic can never be the start of a legacy file, whose first 8 bytes
+        are the name length.
+
+        LoadMode::Map maps the file into memory (see mapped_file.h) instead of reading it. An uncompressed
+        binary file is then used in place: the maze's grid points into the mapping and the payload is never
+        copied. The payload checksum is still verified and the row padding bits cleared, which reads the
+        whole payload once through the mapping. Compressed and legacy files are decoded from the mapping
+        into an ordinary grid.
+
+        LoadMode::MapUnchecked skips both of those, so opening takes the same time for any size and only the
+        rows that are actually looked at are read from disk. The header is still checked, but damage in the
+        payload goes unnoticed and padding bits set by the file break the Grid's rules - use it only for
+        files this program wrote and nobody else touched.
+    */
+    enum class LoadMode {
+        Read,        // read the whole file into memory and decode it
+        Map,         // memory-map the file and use the checked payload in place when possible
+        MapUnchecked // like Map, but trust the payload without reading it
+    };
+
+    /* Replacing Files
+        A file that is memory-mapped must not be truncated - the mapping would suddenly point past the end
+        of the file and the next read of it would crash. So files are written under a temporary name and
+        renamed over the old file once complete, and a failed save never leaves a half written file behind.
+
+        On POSIX systems the old file stays intact for whoever still maps it. Windows refuses to replace a
+        file while any view of it is mapped, so ReplaceFile fails there with the file in use -
+        MazeGenerator::SaveToFile copies a mapped maze into memory before saving for that reason.
+    */
+    std::string TempFileName(const std::string& filename); // name to write to before ReplaceFile
+
+    bool ReplaceFile(const std::string& from, const std::string& to); // removes from if the rename fails
+
+    MazeError SaveMazeFile(const std::string& filename, const Maze& maze, bool compress = false);
+
+    // Loads into an existing maze - reuses its grid buffer when loading many files in a row. On failure
+    // maze may hold part of the file and should not be used.
+    MazeError LoadMazeFile(const std::string& filename, Maze& maze, LoadMode mode = LoadMode::Read);
+
+    Result<Maze> LoadMaze(const std::string& filename, LoadMode mode = LoadMode::Read); // the maze by value
+
+}
@@ -0,0 +1,39 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: mazegen.h
+ * Description:
+ * Single include for programs using the mazegen library.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "result.h"   // MazeError and Result<T>
+#include "maze.h"     // Maze and its packed Grid
+#include "maze_gen.h" // MazeGenerator
+#include "maze_io.h"  // binary save format, SaveMazeFile and LoadMaze
+#include "solver.h"   // Solver
+#include "kernels.h"  // bit-parallel analysis (dead ends, flood fill)
+#include "chunked.h"  // ChunkedMaze (infinite maze)
+#include "fixed_maze.h" // FixedMazeGenerator<W, H> (compile-time sizes)
+#include "export.h"   // PBM, PNG, edge list and CSR export
+#include "deflate.h"  // ZlibWriter (streaming DEFLATE)
+
+/* Using the Library
+
+    Link the mazegen target (CMake: target_link_libraries(App PRIVATE mazegen)). Nothing in the
+    library prints unless asked to draw - errors come back as MazeError values instead:
+
+        MazeGen::MazeGenerator generator(255, 255);
+        MazeGen::Result<MazeGen::Maze> maze = generator.Create(42); // same seed, same maze
+        if (!maze) return MazeGen::MazeErrorMessage(maze.Error());
+        MazeGen::SaveMazeFile("level.maze", maze.Value());
+*/
@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: parallel.h
+ * Description:
+ * Declares the TiledGenerator - carves a maze as tiles on worker threads and
+ * stitches the tiles together into one perfect maze.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "algorithm.h"
+#include "thread_pool.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace MazeGen {
+
+    /* Tiled (Parallel) Generation
+
+        The cells are split into square tiles. Every tile is carved on its own by a worker thread,
+        which gives a perfect maze inside each tile but no way from one tile to another. Then the
+        tiles are stitched: a random spanning tree over the tiles is chosen (Kruskal on the small
+        tile graph) and for every tile pair in that tree exactly one wall on their shared border
+        is opened. A tree of trees joined by single edges is again a tree, so the result is a
+        perfect maze.
+
+        Reproducible: every tile uses its own generator split from the caller's Rng by tile index
+        (see Rng::Split), and the tile layout depends only on the tile size. The same seed therefore
+        gives the same maze whatever the thread count - with one thread the tiles are simply carved
+        one after another on the calling thread. With RngKind::Xoshiro a split costs next to nothing,
+        with the Mersenne Twister every tile has to seed a 5 KB state.
+
+        MazeGenerator tiles every maze that spans more than one default tile, however many threads
+        it has, and carves smaller mazes in one piece. Which of the two a maze gets depends only on
+        its size, so the thread count never changes the maze.
+
+        Tile widths are a multiple of 32 cells. A tile then covers grid columns 64k + 1 to 64k + 63,
+        so no two tiles ever write into the same 64-bit word of the packed grid and the workers
+        need no locking. Border walls between tiles are only touched while stitching, on one thread.
+    */
+    class TiledGenerator {
+    public:
+        static constexpr int kTileAlign = 32; // tile width must be a multiple of this (see above)
+        static constexpr int kDefaultTileCells = 512;
+
+        // True if a width x height grid spans more than one tile of the default size
+        static bool Tiles(int width, int height);
+
+        explicit TiledGenerator(size_t threads = 0); // 0 = one thread per hardware thread
+
+        size_t Threads() const { return m_Pool.Size(); }
+
+        void SetTileSize(int cells); // tile edge in cells, rounded up to a multiple of kTileAlign
+
+        int TileSize() const { return m_TileCells; }
+
+        // Carves every cell of the grid (already filled with walls) into one perfect maze.
+        // Only rng's seed and kind are used, rng itself is not advanced.
+        void Carve(Grid& grid, Algorithm algorithm, const Rng& rng);
+
+        // Creates the per-worker algorithm objects and sizes every buffer for a width x height grid,
+        // so Carve at up to that size does not allocate
+        void Reserve(int width, int height, Algorithm algorithm);
+
+        const CarveCounters& Counters() const { return m_Counters; } // every tile plus the stitching of the last Carve
+
+    private:
+        void prepareEngines(Algorithm algorithm); // one algorithm object of the given kind per worker
+
+        ThreadPool m_Pool;
+        int m_TileCells;
+        std::vector<std::unique_ptr<MazeAlgorithm>> m_Engines; // one algorithm object per worker
+        std::vector<std::uint32_t> m_Parent, m_Edges;          // tile graph union-find and edge list
+        CarveCounters m_Counters;
+    };
+
+}
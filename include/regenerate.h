@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: regenerate.h
+ * Description:
+ * Declares the RegionRegenerator - re-carves one rectangle of an existing
+ * maze while the whole maze stays perfect.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "algorithm.h" // Used for CellRegion
+#include "grid.h"
+#include "rng.h"
+#include <cstdint>
+#include <vector>
+
+namespace MazeGen {
+
+    /* Regional Regeneration
+
+        Carving a region on its own (like a tile of the tiled generator) gives a perfect maze inside
+        it, but the rest of the maze depends on the old region: paths that went through it are what
+        connected the outside parts to each other. Which outside parts those are can only be found
+        by walking the whole maze, and the point is to only touch the region.
+
+        The old region knows enough though. Its cells form a forest, and every tree of that forest
+        joins a group of "openings" (open walls on the region border). The new region has to join
+        exactly the same groups, no more and no less, then the maze is exactly as connected as before.
+
+        The region is re-carved with Kruskal: every inner wall is closed, then the walls are walked
+        in random order and one is opened if it joins two different sets - unless the sets hold
+        openings of two different groups. Every cell ends up in the set of some opening (the region
+        is connected, so a set without one could always still be merged) and groups never merge.
+
+        What can go wrong is a group being cut in two, when other groups grow across the region
+        between its openings first. Then the re-carve is done again from a skeleton: dead-end cells
+        without an opening are cut off the old forest until only the corridors between openings are
+        left, those are kept, and Kruskal only decides the rest. A region with at most one group
+        can never be cut, so it is always carved completely fresh.
+
+        Everything is proportional to the region size. The border walls of the region are never
+        changed. A region without openings (the whole maze) is simply a plain Kruskal maze.
+    */
+    class RegionRegenerator {
+    public:
+        // Re-carves the cells of region - which must lie inside the grid - into a new random layout.
+        // The grid should be a perfect maze; it still is afterwards.
+        void Regenerate(Grid& grid, const CellRegion& region, Rng& rng);
+
+        void Reserve(const CellRegion& region); // buffers for a region this size, never shrinks them
+
+        size_t KeptCells() const { return m_KeptCells; } // cells kept from the old layout by the last Regenerate (0 = all new)
+
+    private:
+        bool carve(const CellRegion& region, Rng& rng, bool skeleton); // false if a group was cut in two
+
+        void pruneToSkeleton(const CellRegion& region);
+
+        std::uint32_t find(std::uint32_t index);
+
+        std::vector<std::uint32_t> m_Parent; // union-find, one entry per region cell
+        std::vector<std::uint32_t> m_Label;  // per cell: the old tree of its opening, or kNoGroup without one
+        std::vector<std::uint32_t> m_Group;  // per set root: the old tree of the openings in the set, or kNoGroup
+        std::vector<std::uint8_t> m_Old;     // per cell: old open walls to the right and below
+        std::vector<std::uint8_t> m_New;     // per cell: new open walls to the right and below
+        std::vector<std::uint8_t> m_Flags;   // per cell: opening, pruned and queued
+        std::vector<std::uint8_t> m_Degree;  // per cell: old open walls to other region cells
+        std::vector<std::uint32_t> m_Queue;  // cells waiting to be pruned
+        std::vector<std::uint32_t> m_Edges;  // walls to decide as (cell index * 2 + direction)
+        size_t m_Groups = 0;                 // old trees with at least one opening
+        size_t m_KeptCells = 0;
+    };
+
+}
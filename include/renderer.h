@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: renderer.h
+ * Description:
+ * Declares the maze renderer - turns a Grid into text (ASCII or Unicode box
+ * drawing, optionally ANSI coloured) written through a fixed-size buffer.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "grid.h"
+#include <cstdio>   // Used for std::FILE and std::fwrite()
+#include <string>
+#include <vector>
+
+namespace MazeGen {
+
+    enum class RenderStyle {
+        Ascii,   // '#' walls and ' ' passages - one byte per cell
+        Unicode, // box drawing characters that join up with neighbouring walls (UTF-8)
+        Count
+    };
+
+    struct RenderOptions {
+        RenderStyle style = RenderStyle::Ascii;
+        bool color = false;                // ANSI colour escape codes around wall runs
+        size_t bufferSize = 64 * 1024;     // bytes collected before each write
+        const Grid* overlay = nullptr;     // optional marks drawn over passages, same size as the grid (see MarkSolution in solver.h)
+    };
+
+    /* Output Buffer
+
+        A fixed-size block of memory that rendered text is copied into. When it is full it is
+        handed to the operating system in one call - fwrite() for a FILE*, or write(2) for a file
+        descriptor - and then reused. However big the maze, only bufferSize bytes are ever held.
+    */
+    class OutputBuffer {
+    public:
+        explicit OutputBuffer(std::FILE* file, size_t capacity = 64 * 1024);
+        explicit OutputBuffer(int fd, size_t capacity = 64 * 1024); // POSIX file descriptor (e.g. 1 = stdout)
+        ~OutputBuffer() { Flush(); }
+
+        OutputBuffer(const OutputBuffer&) = delete;
+        OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+        // Space for n more bytes (n <= capacity). Write into it, then call Commit with the bytes used.
+        char* Reserve(size_t n) {
+            if (m_Used + n > m_Data.size()) Flush();
+            return m_Data.data() + m_Used;
+        }
+
+        void Commit(size_t n) { m_Used += n; }
+
+        void Append(const char* text, size_t n);
+
+        void Append(const std::string& text) { Append(text.data(), text.size()); }
+
+        void Put(char c) { *Reserve(1) = c; Commit(1); }
+
+        bool Flush(); // writes everything collected so far, false once any write failed
+
+        bool Good() const { return m_Good; }
+
+        size_t Capacity() const { return m_Data.size(); }
+
+    private:
+        std::FILE* m_File;
+        int m_Fd;
+        std::vector<char> m_Data;
+        size_t m_Used;
+        bool m_Good;
+    };
+
+    // Renders every row of the grid followed by '\n'. Returns false if writing failed.
+    bool RenderGrid(const Grid& grid, OutputBuffer& out, const RenderOptions& options = RenderOptions());
+
+    // Convenience: renders to a FILE* (e.g. stdout) through its own buffer of options.bufferSize bytes
+    bool RenderGrid(const Grid& grid, std::FILE* file, const RenderOptions& options = RenderOptions());
+
+    const char* RenderStyleName(RenderStyle style);
+
+}
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: result.h
+ * Description:
+ * Declares the error codes and the Result type returned by the library API
+ * instead of printing messages.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <optional>
+#include <utility>
+
+namespace MazeGen {
+
+    /* Errors
+
+        The library never prints. A call that can fail returns what went wrong, and the program
+        using it (the console driver, a service, ...) decides whether and how to tell anyone.
+    */
+    enum class MazeError {
+        None,          // success
+        NoDimensions,  // width or height not set
+        NoMaze,        // nothing generated or loaded yet
+        OpenFailed,    // the file could not be opened or created
+        WriteFailed,   // writing the file failed part way
+        ReadFailed,    // reading the file failed part way
+        InvalidFile,   // not a maze file, or damaged (bad checksum, truncated)
+        NoSolution,    // no path from the entrance to the exit
+        InvalidRegion, // the region is empty or does not lie inside the maze
+        TooLarge,      // the maze does not fit the limits of the export format
+        BadDimensions  // width or height below 3 or even where an operation needs odd sizes of at least 3
+    };
+
+    const char* MazeErrorMessage(MazeError error); // short English description, e.g. for the console driver
+
+    /* Result
+
+        A value or the reason there is none - the same idea as C++23's std::expected<T, MazeError>,
+        for C++17. Values are moved in and can be moved back out, so returning a whole Maze by
+        value does not copy its grid.
+
+            Result<Maze> result = LoadMaze("level.maze");
+            if (!result) return result.Error();
+            Maze maze = std::move(result).Value();
+    */
+    template <typename T>
+    class Result {
+    public:
+        Result(T value) : m_Value(std::move(value)), m_Error(MazeError::None) {}
+        Result(MazeError error) : m_Error(error) {} // error must not be MazeError::None
+
+        bool HasValue() const { return m_Value.has_value(); }
+        explicit operator bool() const { return HasValue(); }
+
+        MazeError Error() const { return m_Error; }
+
+        T& Value() & { return *m_Value; }
+        const T& Value() const& { return *m_Value; }
+        T&& Value() && { return std::move(*m_Value); }
+
+        T* operator->() { return &*m_Value; }
+        const T* operator->() const { return &*m_Value; }
+
+    private:
+        std::optional<T> m_Value;
+        MazeError m_Error;
+    };
+
+}
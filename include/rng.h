@@ -0,0 +1,150 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: rng.h
+ * Description:
+ * Declares the Rng class - the random number source used by every algorithm,
+ * with a choice of engine (Mersenne Twister or xoshiro256**).
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <iterator>
+#include <random>   // Used for std::mt19937
+#include <utility>
+#include <variant>  // Used to hold exactly one of the engines
+
+namespace MazeGen {
+
+    enum class RngKind {
+        MersenneTwister, // std::mt19937 - the engine the project always used, ~5 KB of state
+        Xoshiro,         // xoshiro256** - 32 bytes of state, faster, cheap to create per thread or tile
+        Count
+    };
+
+    const char* RngKindName(RngKind kind); // "mt19937" or "xoshiro"
+
+    bool ParseRngKind(const char* name, RngKind& out);
+
+    // Mixes a seed and a stream number into a new, unrelated seed (SplitMix64 finalizer)
+    std::uint64_t DeriveSeed(std::uint64_t seed, std::uint64_t stream);
+
+    // xoshiro256** by David Blackman and Sebastiano Vigna (public domain algorithm)
+    class Xoshiro256 {
+    public:
+        using result_type = std::uint64_t;
+
+        explicit Xoshiro256(std::uint64_t seed = 0) { Seed(seed); }
+
+        void Seed(std::uint64_t seed); // fills the 256 bit state from the seed with SplitMix64
+
+        std::uint64_t operator()() {
+            const std::uint64_t result = rotl(m_State[1] * 5, 7) * 9;
+            const std::uint64_t t = m_State[1] << 17;
+            m_State[2] ^= m_State[0];
+            m_State[3] ^= m_State[1];
+            m_State[1] ^= m_State[2];
+            m_State[0] ^= m_State[3];
+            m_State[2] ^= t;
+            m_State[3] = rotl(m_State[3], 45);
+            return result;
+        }
+
+    private:
+        static std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+        std::uint64_t m_State[4];
+    };
+
+    /* Rng (Random Number Policy)
+
+        Every algorithm draws its random numbers from an Rng. The engine is chosen at run time:
+        the Mersenne Twister keeps the old behaviour, xoshiro256** is the fast small-state option.
+        Each call checks which engine is active, a branch that is always predicted correctly.
+
+        The same seed and kind always give the same sequence of numbers, and every random
+        decision in the project goes through Bounded() or Shuffle() below instead of
+        std::uniform_int_distribution / std::shuffle. Those two are implemented differently by
+        each standard library, so using them would give different mazes on different compilers.
+
+        Split(stream) creates an independent generator for a thread, a tile or a batch entry,
+        derived only from this generator's seed and the stream number.
+
+        Rng satisfies UniformRandomBitGenerator, so it can still be passed to <random> if needed.
+    */
+    class Rng {
+    public:
+        using result_type = std::uint32_t;
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return 0xFFFFFFFFu; }
+
+        explicit Rng(std::uint64_t seed = 0, RngKind kind = RngKind::MersenneTwister);
+
+        void Seed(std::uint64_t seed); // restarts the sequence, keeps the kind
+
+        void Reset(std::uint64_t seed, RngKind kind);
+
+        std::uint64_t GetSeed() const { return m_Seed; }
+        RngKind Kind() const { return m_Kind; }
+
+        Rng Split(std::uint64_t stream) const { return Rng(DeriveSeed(m_Seed, stream), m_Kind); }
+
+        result_type operator()() {
+            if (m_Kind == RngKind::Xoshiro) return static_cast<result_type>(std::get<Xoshiro256>(m_Engine)() >> 32); // high bits are the best
+            return static_cast<result_type>(std::get<std::mt19937>(m_Engine)());
+        }
+
+        // Unbiased number in [0, range) - Lemire's multiply and shift method. range must be > 0.
+        // Unlike "rng() % range" every value is exactly equally likely.
+        std::uint32_t Bounded(std::uint32_t range) {
+            std::uint64_t product = std::uint64_t((*this)()) * range;
+            std::uint32_t low = static_cast<std::uint32_t>(product);
+            if (low < range) {
+                const std::uint32_t threshold = static_cast<std::uint32_t>(-range) % range;
+                while (low < threshold) {
+                    product = std::uint64_t((*this)()) * range;
+                    low = static_cast<std::uint32_t>(product);
+                }
+            }
+            return static_cast<std::uint32_t>(product >> 32);
+        }
+
+        // Unbiased number in [0, range) for ranges that may not fit in 32 bits
+        std::uint64_t Bounded64(std::uint64_t range) {
+            if (range <= 0xFFFFFFFFull) return Bounded(static_cast<std::uint32_t>(range));
+            const std::uint64_t limit = ~std::uint64_t(0) - (~std::uint64_t(0) % range); // reject the uneven tail
+            std::uint64_t value;
+            do {
+                value = (std::uint64_t((*this)()) << 32) | (*this)();
+            } while (value >= limit);
+            return value % range;
+        }
+
+        // Fisher-Yates shuffle using Bounded - the same result on every platform
+        template <class RandomIt>
+        void Shuffle(RandomIt first, RandomIt last) {
+            auto count = last - first;
+            for (auto i = count - 1; i > 0; i--) {
+                auto j = static_cast<decltype(i)>(Bounded64(static_cast<std::uint64_t>(i) + 1));
+                using std::swap;
+                swap(first[i], first[j]);
+            }
+        }
+
+    private:
+        std::uint64_t m_Seed;
+        RngKind m_Kind;
+        std::variant<Xoshiro256, std::mt19937> m_Engine; // xoshiro first so constructing an Rng never pays for a Mersenne Twister it does not use
+    };
+
+}
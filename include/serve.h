@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: serve.h
+ * Description:
+ * Declares the serve mode - a long running generation service that takes
+ * requests as JSON lines over a Unix domain socket or stdin - and a small
+ * client for it.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "algorithm.h"
+#include "rng.h"
+#include <cstdint>
+#include <string>
+
+namespace MazeGen {
+
+    struct ServeOptions {
+        std::string socketPath;   // Unix domain socket to listen on, empty = requests on stdin, responses on stdout
+        int threads = 0;          // generation workers, 0 = one per hardware thread
+        size_t queueSize = 256;   // requests waiting for a worker before the server stops reading (backpressure)
+        int maxSide = 8191;       // largest width or height a request may ask for
+    };
+
+    struct ClientOptions {
+        std::string socketPath;   // socket of a running "MazeGen serve --socket"
+        size_t count = 1000;      // requests to send
+        int width = 15, height = 9;
+        std::uint64_t seed = 0;   // request i asks for the seed derived from (seed, i), like batch mode
+        Algorithm algorithm = Algorithm::Backtracker;
+        RngKind rng = RngKind::MersenneTwister;
+        bool compress = false;
+        size_t inflight = 1;      // requests sent before waiting for a response - 1 measures latency, more throughput
+    };
+
+    /* Serve Mode
+
+        Batch mode starts a process per batch; a level generation backend wants one process that
+        stays up and answers requests as they come. "MazeGen serve" reads one request per line -
+        a flat JSON object, every field optional:
+
+            {"id": 7, "width": 31, "height": 31, "seed": 42, "algorithm": "kruskal",
+             "rng": "xoshiro", "compress": false, "format": "binary", "name": "level_7"}
+
+        id is echoed back (default: the line number on that connection), a missing seed picks a
+        random one, format is "binary" (the save format of maze_io.h) or "legacy". Every request
+        gets one response: a JSON header line, followed by exactly "size" bytes of the maze record
+        when ok is true:
+
+            {"id":7,"ok":true,"width":31,"height":31,"seed":42,"algorithm":"kruskal","format":"binary","size":256,"micros":41}
+            {"id":8,"ok":false,"error":"unknown algorithm 'maze'"}
+
+        micros is the time from reading the request to sending the response, queueing included.
+
+        Requests go into a bounded queue that a fixed set of worker threads take from. Each worker
+        owns a MazeGenerator and an output buffer for the whole run, so a small request does no
+        setup at all - it is carved into buffers that are already there. Responses are sent as
+        soon as a worker is done, so they can come back in a different order than the requests
+        (match them by id). When the queue is full, the server stops reading until a worker frees
+        a slot, so a client that sends faster than the server generates is slowed down by its own
+        socket instead of growing the server's memory.
+
+        With --socket every connection gets its own reader thread and all of them share the queue
+        and the workers; Ctrl+C (SIGINT or SIGTERM) stops accepting, answers what was already read
+        and exits. Without --socket requests are read from stdin and answered on stdout until stdin
+        ends - log messages always go to stderr. Unix domain sockets are not available on Windows.
+
+        "MazeGen client" is the matching load generator: it sends count requests over the socket,
+        keeps up to --inflight of them outstanding, checks every maze record it gets back and
+        reports the throughput and the latency percentiles.
+    */
+
+    // Parse the arguments that follow "serve" / "client" on the command line. On failure error holds the reason.
+    bool ParseServeArgs(int argc, char* argv[], int first, ServeOptions& options, std::string& error);
+
+    bool ParseClientArgs(int argc, char* argv[], int first, ClientOptions& options, std::string& error);
+
+    int RunServe(const ServeOptions& options); // returns the process exit code
+
+    int RunClient(const ClientOptions& options); // returns the process exit code, 1 if any request failed
+
+}
@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: solver.h
+ * Description:
+ * Declares the maze solver - BFS, A*, bidirectional BFS and dead-end filling.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include "grid.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MazeGen {
+
+    enum class SolveMethod {
+        Bfs,           // breadth first search - shortest path, explores evenly in every direction
+        AStar,         // best first with a distance estimate - explores towards the exit first
+        Bidirectional, // breadth first from both ends until the searches meet
+        DeadEndFill,   // fills every dead end until only the path is left
+        Count
+    };
+
+    const char* SolveMethodName(SolveMethod method); // lower case name, e.g. "astar"
+
+    bool ParseSolveMethod(const std::string& name, SolveMethod& out); // accepts the names from SolveMethodName
+
+    struct SolveStats {
+        size_t visited = 0;     // cells taken from the queue, or filled
+        size_t maxFrontier = 0; // largest number of cells waiting in the queue at once (longest filled corridor for dead-end filling)
+        double seconds = 0.0;
+    };
+
+    /* Solution
+
+        The solver works on cells like the algorithms do (see CellRegion in algorithm.h): cell
+        (cx, cy) is grid position (2 * cx + 1, 2 * cy + 1) and cell index cy * cols + cx.
+        The path lists the cells from the one behind the entrance to the one before the exit.
+        Entrance and exit are openings in the outer wall - the first and last ones found
+        scanning the top row, left column, right column and bottom row.
+    */
+    struct Solution {
+        bool solved = false;
+        int width = 0, height = 0;        // grid size of the solved maze
+        int cols = 0, rows = 0;           // the same in cells
+        int startX = 0, startY = 0;       // grid position of the entrance opening
+        int goalX = 0, goalY = 0;         // grid position of the exit opening
+        std::vector<std::uint32_t> path;  // cell indices from entrance to exit
+        SolveStats stats;
+    };
+
+    /* Solver
+
+        Like the generation algorithms, a Solver keeps its scratch buffers (visited bitset,
+        queues) between calls, so solving one maze after another does not reallocate.
+        All bookkeeping is flat: a bit per cell for "seen", a byte per cell for the direction
+        a cell was reached from, and queues of cell indices.
+
+        Mazes with 2^32 cells or more are not supported (Solve returns false).
+    */
+    class Solver {
+    public:
+        // Finds a path from the entrance to the exit. Returns out.solved - false if the grid has no
+        // entrance/exit pair or no path connects them.
+        bool Solve(const Grid& grid, SolveMethod method, Solution& out);
+
+    private:
+        bool bfs(const Grid& grid, Solution& out);
+        bool aStar(const Grid& grid, Solution& out);
+        bool bidirectional(const Grid& grid, Solution& out);
+        bool deadEndFill(const Grid& grid, Solution& out);
+
+        // A growable ring buffer of cell indices - the frontier of a breadth first search
+        struct CellQueue {
+            std::vector<std::uint32_t> items;
+            size_t head = 0, count = 0;
+
+            void Reset() { head = count = 0; if (items.empty()) items.resize(1024); }
+            bool Empty() const { return count == 0; }
+            void Push(std::uint32_t cell);
+            std::uint32_t Pop();
+        };
+
+        std::vector<Grid::Word> m_Seen, m_SeenOther; // visited bitsets, one bit per cell
+        std::vector<std::uint8_t> m_From;            // per cell: direction it was reached from (or degree for dead-end filling)
+        CellQueue m_Queue, m_QueueOther;
+        std::vector<std::uint64_t> m_Bucket[2]; // A* open set: cells at the current cost and at cost + 2
+    };
+
+    // Sets every grid position on the solution - entrance, exit, path cells and the openings between
+    // them - in overlay, which is resized to the solved grid. Used to draw the path (see RenderOptions).
+    void MarkSolution(const Solution& solution, Grid& overlay);
+
+}
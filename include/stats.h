@@ -0,0 +1,126 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: stats.h
+ * Description:
+ * Declares the instrumentation layer - scoped timers, carve counters and the
+ * GenerationStats returned by MazeGenerator. Compiled out entirely when
+ * MAZEGEN_ENABLE_STATS is 0.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+/* Turning Statistics Off
+
+    Statistics are on by default. Configure with -DMAZEGEN_ENABLE_STATS=OFF (CMake) to build
+    without them: every MAZEGEN_STAT and MAZEGEN_SCOPED_TIMER below then expands to nothing,
+    so not even a clock read is left in the generated code, and GenerationStats stays zero
+    with enabled = false.
+*/
+#ifndef MAZEGEN_ENABLE_STATS
+#define MAZEGEN_ENABLE_STATS 1
+#endif
+
+#define MAZEGEN_STATS_JOIN2(a, b) a##b
+#define MAZEGEN_STATS_JOIN(a, b) MAZEGEN_STATS_JOIN2(a, b)
+
+#if MAZEGEN_ENABLE_STATS
+#define MAZEGEN_STAT(...) __VA_ARGS__ // a statement that only exists with statistics on
+#define MAZEGEN_SCOPED_TIMER(seconds) ::MazeGen::ScopedTimer MAZEGEN_STATS_JOIN(scopedTimer_, __LINE__)(seconds)
+#else
+#define MAZEGEN_STAT(...)
+#define MAZEGEN_SCOPED_TIMER(seconds) ((void)0)
+#endif
+
+namespace MazeGen {
+
+    static constexpr bool kStatsEnabled = MAZEGEN_ENABLE_STATS != 0;
+
+    // Adds the time from construction to the end of the scope to seconds. Use through MAZEGEN_SCOPED_TIMER.
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(double& seconds) : m_Seconds(seconds), m_Start(std::chrono::steady_clock::now()) {}
+        ~ScopedTimer() { m_Seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count(); }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        double& m_Seconds;
+        std::chrono::steady_clock::time_point m_Start;
+    };
+
+    inline void StatMax(std::uint64_t& target, std::uint64_t value) {
+        if (value > target) target = value;
+    }
+
+    /* Carve Counters
+
+        Filled in by the algorithms while they carve (see MazeAlgorithm::Counters in algorithm.h).
+        What a "step" and the "depth" are depends on the algorithm:
+                        steps                       max depth
+            backtracker directions tried            deepest stack
+            eller       cells                       -
+            kruskal     walls looked at             -
+            prim        frontier cells taken        largest frontier
+            wilson      random walk moves           longest walk
+    */
+    struct CarveCounters {
+        std::uint64_t cellsVisited = 0; // cells opened
+        std::uint64_t wallsRemoved = 0; // walls between cells opened
+        std::uint64_t steps = 0;
+        std::uint64_t maxDepth = 0;
+        std::uint64_t scratchBytes = 0; // memory held by the algorithm's own buffers
+
+        // Adds the counters of another carve that ran at the same time (a tile on another thread)
+        void Merge(const CarveCounters& other) {
+            cellsVisited += other.cellsVisited;
+            wallsRemoved += other.wallsRemoved;
+            steps += other.steps;
+            StatMax(maxDepth, other.maxDepth);
+            scratchBytes += other.scratchBytes; // the buffers of every thread exist at once
+        }
+    };
+
+    /* Generation Statistics
+
+        Returned by MazeGenerator::GetStats. Generate fills in the generation part, Display, SaveToFile
+        and LoadFromFile the time (and bytes) of their last call.
+    */
+    struct GenerationStats {
+        bool enabled = kStatsEnabled;
+
+        // Last generation
+        int width = 0, height = 0;
+        int threads = 1;
+        double generateSeconds = 0.0; // everything: filling the grid, carving, entrance and exit
+        double carveSeconds = 0.0;
+        double entranceSeconds = 0.0;
+        CarveCounters carve;
+        std::uint64_t gridBytes = 0;
+        std::uint64_t peakBytes = 0;  // grid plus the algorithm buffers - what the generation needed at its peak
+
+        // Last display, save and load
+        double displaySeconds = 0.0;
+        double saveSeconds = 0.0;
+        std::uint64_t savedBytes = 0;
+        double loadSeconds = 0.0;
+        std::uint64_t loadedBytes = 0;
+    };
+
+    void PrintGenerationStats(std::ostream& out, const GenerationStats& stats);
+
+}
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: stream.h
+ * Description:
+ * Declares streaming maze generation - finished rows are handed to a sink
+ * instead of being kept in memory.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <fstream>
+#include "maze.h"     // Used for the record header the file sink writes
+#include "rng.h"
+#include "renderer.h" // Used for the console sink's output buffer
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MazeGen {
+
+    /* Row Sink
+
+        Receives a maze one grid row at a time, top to bottom, as printable characters
+        ('#' wall, ' ' passage). A sink never sees more than one row, so it can write the
+        row somewhere and forget it. Returning false from any call stops the stream.
+    */
+    class RowSink {
+    public:
+        virtual ~RowSink() = default;
+
+        virtual bool Begin(int width, int height) = 0;
+        virtual bool WriteRow(const char* row, int width) = 0;
+        virtual bool End() = 0;
+    };
+
+    /* File Sink
+        Writes an uncompressed binary record, the same format MazeGenerator::SaveToFile writes, so the file
+        loads (and memory-maps) normally. The header only needs the width and height, so it goes out first
+        with a placeholder payload checksum. Every row is packed into words and added to a running CRC-32,
+        and End writes the header again with the final checksum. The record says Eller's algorithm and
+        the seed and rng kind given here, which recreate the maze up to the tile size (see StreamMaze).
+    */
+    class FileRowSink : public RowSink {
+    public:
+        explicit FileRowSink(const std::string& filename, std::uint64_t seed = 0, RngKind kind = RngKind::MersenneTwister);
+        ~FileRowSink(); // removes the temporary file if End was never reached
+
+        bool IsOpen() const { return m_File.is_open(); } // false if the temporary file could not be created
+
+        bool Begin(int width, int height) override;
+        bool WriteRow(const char* row, int width) override;
+        bool End() override; // moves the finished file into place (see ReplaceFile in maze_io.h)
+
+    private:
+        std::string m_TempName;
+        std::ofstream m_File;
+        Maze m_Header;                     // name, size, algorithm and seed for the record header - its grid stays empty
+        Grid m_Row;                        // the current row, packed
+        std::vector<std::uint8_t> m_Bytes; // header or row bytes on their way to the file
+        std::uint32_t m_Crc = 0;           // CRC-32 of the rows written so far
+        bool m_Done = false;
+    };
+
+    // Prints rows to the console the same way MazeGenerator::Display does, through one reused output buffer
+    class ConsoleRowSink : public RowSink {
+    public:
+        explicit ConsoleRowSink(const std::string& name = "Unnamed") : m_Name(name), m_Out(stdout) {}
+
+        bool Begin(int width, int height) override;
+        bool WriteRow(const char* row, int width) override;
+        bool End() override;
+
+    private:
+        std::string m_Name;
+        OutputBuffer m_Out;
+    };
+
+    /* Streaming Generation
+
+        Generates a width x height maze with Eller's algorithm (see EllerRows in algorithm.h) and
+        hands every finished row to the sink. Only a couple of rows are alive at any time, so peak
+        memory is proportional to the width no matter how tall the maze is.
+
+        Entrance and exit follow the same rules as MazeGenerator::addEntranceAndExit. Every cell
+        of the last row is open in Eller's algorithm, so the exit is a random cell column picked
+        right before the bottom border is written. The result is the same maze Generate would
+        produce with the Eller algorithm and the same random state, up to one tile (1025 x 1025,
+        see parallel.h) - Generate tiles bigger mazes, the stream never does.
+
+        Returns false if the dimensions are invalid or the sink fails.
+    */
+    bool StreamMaze(int width, int height, Rng& rng, RowSink& sink);
+
+}
@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: thread_pool.h
+ * Description:
+ * Declares a small fixed-size thread pool used for parallel generation.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MazeGen {
+
+    /* Thread Pool
+
+        Starting a thread is expensive compared to carving a small tile, so the worker threads
+        are created once and then wait for tasks. Submit() puts a task in the queue and one of
+        the workers picks it up. Wait() blocks until every submitted task has finished.
+
+        ParallelFor() does not go through the queue. Queuing means a std::function and a deque node
+        per task, both on the heap, and the tiled generator runs a ParallelFor for every maze. Instead
+        the body is published in one job slot that idle workers join, so a ParallelFor does not
+        allocate at all.
+
+        Do not call Wait() or ParallelFor() from inside a task - the task would wait for itself.
+    */
+    class ThreadPool {
+    public:
+        explicit ThreadPool(size_t threads = 0); // 0 = one thread per hardware thread
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        size_t Size() const { return m_Workers.size(); }
+
+        void Submit(std::function<void()> task);
+
+        void Wait();
+
+        // Runs body(index, worker) for every index in [0, count) and returns when all are done.
+        // worker is in [0, Size()) and no two calls with the same worker run at the same time,
+        // so it can index per-worker scratch data without locking.
+        template <typename Body>
+        void ParallelFor(size_t count, const Body& body) {
+            // A plain function pointer calls the body through a void pointer - unlike a std::function
+            // it never needs to copy the body (and its captures) to the heap
+            runJob(count, [](const void* context, size_t index, size_t worker) {
+                (*static_cast<const Body*>(context))(index, worker);
+            }, &body);
+        }
+
+        static size_t HardwareThreads();
+
+    private:
+        using JobFunction = void (*)(const void* context, size_t index, size_t worker);
+
+        void runJob(size_t count, JobFunction function, const void* context);
+
+        void workerLoop();
+
+        std::vector<std::thread> m_Workers;
+        std::deque<std::function<void()>> m_Tasks;
+        std::mutex m_Mutex;
+        std::condition_variable m_TaskReady; // signalled when a task is queued or the pool stops
+        std::condition_variable m_Idle;      // signalled when the last running task finishes
+        size_t m_Active = 0;                 // tasks currently running
+        bool m_Stop = false;
+
+        // The ParallelFor job slot. Workers take a seat (their worker index for the body) while seats
+        // are left and the job is one they have not joined yet.
+        JobFunction m_JobFunction = nullptr;
+        const void* m_JobContext = nullptr;
+        size_t m_JobCount = 0;
+        std::atomic<size_t> m_JobNext{ 0 };  // next index to run
+        size_t m_JobSeats = 0;               // workers allowed to join, 0 = no job
+        size_t m_JobSeatsTaken = 0;
+        size_t m_JobRunning = 0;             // workers inside the job right now
+        std::uint64_t m_JobNumber = 0;       // counts jobs, so no worker joins the same job twice
+        std::condition_variable m_JobDone;   // signalled when a worker leaves the job or the slot frees up
+    };
+
+}
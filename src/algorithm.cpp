@@ -0,0 +1,54 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: algorithm.cpp
+ * Description:
+ * Implements the algorithm registry - maps ids and names to algorithm objects.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "algorithm.h"
+
+namespace MazeGen {
+
+    // Names indexed by the Algorithm enum value - keep in the same order as the enum
+    static const char* const s_AlgorithmNames[] = { "backtracker", "eller", "kruskal", "prim", "wilson" };
+
+    static_assert(sizeof(s_AlgorithmNames) / sizeof(s_AlgorithmNames[0]) == static_cast<size_t>(Algorithm::Count),
+        "every algorithm needs a name");
+
+    std::unique_ptr<MazeAlgorithm> CreateAlgorithm(Algorithm id) {
+        switch (id) {
+        case Algorithm::Backtracker: return std::make_unique<BacktrackerAlgorithm>();
+        case Algorithm::Eller:       return std::make_unique<EllerAlgorithm>();
+        case Algorithm::Kruskal:     return std::make_unique<KruskalAlgorithm>();
+        case Algorithm::Prim:        return std::make_unique<PrimAlgorithm>();
+        case Algorithm::Wilson:      return std::make_unique<WilsonAlgorithm>();
+        default:                     return nullptr;
+        }
+    }
+
+    const char* AlgorithmName(Algorithm id) {
+        size_t index = static_cast<size_t>(id);
+        return index < static_cast<size_t>(Algorithm::Count) ? s_AlgorithmNames[index] : "unknown";
+    }
+
+    bool ParseAlgorithm(const std::string& name, Algorithm& out) {
+        for (size_t i = 0; i < static_cast<size_t>(Algorithm::Count); i++) {
+            if (name == s_AlgorithmNames[i]) {
+                out = static_cast<Algorithm>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+}
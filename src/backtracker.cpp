@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: backtracker.cpp
+ * Description:
+ * Implements the (iterative) recursive backtracking algorithm.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "algorithm.h"
+
+namespace MazeGen {
+
+    void BacktrackerAlgorithm::Reserve(const CellRegion& region) {
+        m_Stack.reserve(region.CellCount()); // worst case depth is one frame per cell (a single long corridor)
+    }
+
+    void BacktrackerAlgorithm::Carve(Grid& grid, const CellRegion& region, Rng& rng) {
+        /* Explicit Stack instead of Recursion
+
+            The first version of this algorithm called itself once per carved cell. Every call needs a stack
+            frame, so a big maze (a few thousand cells on a side) would run past the default thread stack size
+            and crash. Now each "call" is a small Frame pushed onto m_Stack, a vector that lives on the heap.
+
+            Each frame remembers which cell it is working on, its own shuffled direction order and
+            which of those directions it will try next. That is all the state a recursive call kept.
+
+            The stack can never be deeper than the number of cells, so it is reserved up front and
+            push_back will never have to reallocate in the middle of carving.
+
+            Note: the very first version shared ONE static direction list between all calls. A call that
+            resumed after its children had reshuffled the list could try one direction twice and skip
+            another, which left some cells sealed off. Every frame now owns its order, so every cell is
+            reached and the result is a perfect maze like the other algorithms produce.
+        */
+        // Moves two cells at a time to ensure clear paths are created and walls remain intact between paths.
+        static const int dx[] = { 0,  0, -2,  2 }; // Movement offsets for Left & Right
+        static const int dy[] = { -2, 2,  0,  0 }; // Movement offsets for Up & Down
+
+        if (region.cols <= 0 || region.rows <= 0) return;
+
+        Reserve(region);
+        m_Stack.clear();
+
+        // First and last cell of the region in grid coordinates - a move must land inside these
+        const int minX = region.GridX(0), maxX = region.GridX(region.cols - 1);
+        const int minY = region.GridY(0), maxY = region.GridY(region.rows - 1);
+
+        // lambda function to easily check the bounds of the new position
+        auto isBounds = [](int ax, int lo, int hi) {
+            return (ax >= lo) && (ax <= hi);
+        };
+
+        auto push = [&](int x, int y) {
+            // Mark the cell as an open path (' ') and remember it on the explicit stack with a freshly
+            // shuffled direction order (0: Up, 1: Down, 2: Left, 3: Right)
+            grid.SetPassage(x, y);
+            m_Stack.push_back({ x, y, { 0, 1, 2, 3 }, 0 });
+            rng.Shuffle(m_Stack.back().dirs.begin(), m_Stack.back().dirs.end());
+            MAZEGEN_STAT(m_Counters.cellsVisited++, StatMax(m_Counters.maxDepth, m_Stack.size()));
+        };
+
+        push(minX, minY); // start in the top left cell of the region
+
+        while (!m_Stack.empty()) {
+            Frame& frame = m_Stack.back();
+
+            // All four directions tried - this is the same as returning from the recursive call
+            if (frame.next == 4) {
+                m_Stack.pop_back();
+                continue;
+            }
+
+            // Calculate the new cell coordinates by moving two steps in the next direction
+            int dir = frame.dirs[frame.next++];
+            MAZEGEN_STAT(m_Counters.steps++);
+            int nx = frame.x + dx[dir]; // new x position
+            int ny = frame.y + dy[dir]; // new y position
+
+            // Check if the new cell is within the region and is still a wall ('#')
+            if (isBounds(ny, minY, maxY) &&
+                isBounds(nx, minX, maxX) &&
+                grid.IsWall(nx, ny)) {
+
+                // Carve a passage by opening the wall between the current cell and the new cell
+                grid.SetPassage(frame.x + dx[dir] / 2, frame.y + dy[dir] / 2);
+                MAZEGEN_STAT(m_Counters.wallsRemoved++);
+
+                // "Recurse" into the new cell. Careful: push_back may invalidate the frame reference,
+                // which is fine because it is not used again in this iteration.
+                push(nx, ny);
+            }
+        }
+
+        MAZEGEN_STAT(StatMax(m_Counters.scratchBytes, m_Stack.capacity() * sizeof(Frame)));
+    }
+
+}
@@ -0,0 +1,250 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: batch.cpp
+ * Description:
+ * Implements the non-interactive batch generation mode.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "batch.h"
+#include "maze_gen.h"
+#include "maze_io.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>     // Used for timing the batch
+#include <cstdio>     // Used for std::snprintf() when building file names
+#include <filesystem> // Used for creating the output directory
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace MazeGen {
+
+    static std::string mazeName(size_t index) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "maze_%06zu", index);
+        return name;
+    }
+
+    bool ReadNumberArg(int argc, char* argv[], int& i, long long& value, std::string& error) {
+        if (i + 1 >= argc) {
+            error = std::string("missing value after ") + argv[i];
+            return false;
+        }
+        try {
+            size_t used = 0;
+            value = std::stoll(argv[i + 1], &used);
+            if (used != std::string(argv[i + 1]).size()) throw std::invalid_argument("trailing characters");
+        }
+        catch (const std::exception&) {
+            error = std::string("expected a number after ") + argv[i] + ", got '" + argv[i + 1] + "'";
+            return false;
+        }
+        i++;
+        return true;
+    }
+
+    bool ParseBatchArgs(int argc, char* argv[], int first, BatchOptions& options, std::string& error) {
+        for (int i = first; i < argc; i++) {
+            std::string arg = argv[i];
+            long long value = 0;
+
+            if (arg == "--count") {
+                if (!ReadNumberArg(argc, argv, i, value, error)) return false;
+                if (value <= 0) { error = "--count must be positive"; return false; }
+                options.count = static_cast<size_t>(value);
+            }
+            else if (arg == "--width" || arg == "--height") {
+                if (!ReadNumberArg(argc, argv, i, value, error)) return false;
+                if (value < 3 || value > 1000000) { error = arg + " must be between 3 and 1000000"; return false; }
+                int odd = static_cast<int>(value % 2 == 0 ? value + 1 : value); // same odd rule as SetDimensions
+                (arg == "--width" ? options.width : options.height) = odd;
+            }
+            else if (arg == "--seed") {
+                if (!ReadNumberArg(argc, argv, i, value, error)) return false;
+                options.seed = static_cast<std::uint64_t>(value);
+                options.hasSeed = true;
+            }
+            else if (arg == "--rng") {
+                if (i + 1 >= argc || !ParseRngKind(argv[i + 1], options.rng)) {
+                    error = "--rng expects mt19937 or xoshiro";
+                    return false;
+                }
+                i++;
+            }
+            else if (arg == "--threads") {
+                if (!ReadNumberArg(argc, argv, i, value, error)) return false;
+                if (value < 0) { error = "--threads cannot be negative"; return false; }
+                options.threads = static_cast<int>(value);
+            }
+            else if (arg == "--algorithm") {
+                if (i + 1 >= argc || !ParseAlgorithm(argv[i + 1], options.algorithm)) {
+                    error = "--algorithm expects one of: backtracker, eller, kruskal, prim, wilson";
+                    return false;
+                }
+                i++;
+            }
+            else if (arg == "--solve") {
+                if (i + 1 >= argc || !ParseSolveMethod(argv[i + 1], options.solveMethod)) {
+                    error = "--solve expects one of: bfs, astar, bidirectional, deadend";
+                    return false;
+                }
+                options.solve = true;
+                i++;
+            }
+            else if (arg == "--compress") {
+                options.compress = true;
+            }
+            else if (arg == "--legacy") {
+                options.legacy = true;
+            }
+            else if (arg == "--out" || arg == "--archive") {
+                if (i + 1 >= argc) { error = "missing path after " + arg; return false; }
+                (arg == "--out" ? options.outDir : options.archive) = argv[++i];
+            }
+            else {
+                error = "unknown option '" + arg + "'";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int RunBatch(const BatchOptions& options) {
+        std::random_device device;
+        const std::uint64_t seed = options.hasSeed ? options.seed : (static_cast<std::uint64_t>(device()) << 32) | device();
+        const bool toArchive = !options.archive.empty();
+
+        std::ofstream archive;
+        if (toArchive) {
+            archive.open(options.archive, std::ios::binary);
+            if (!archive) {
+                std::cerr << "Error opening archive " << options.archive << "!\n";
+                return 1;
+            }
+        }
+        else {
+            std::error_code ec;
+            std::filesystem::create_directories(options.outDir, ec);
+            if (ec) {
+                std::cerr << "Error creating directory " << options.outDir << ": " << ec.message() << '\n';
+                return 1;
+            }
+        }
+
+        ThreadPool pool(options.threads > 0 ? options.threads : 0);
+
+        // One generator per worker - each keeps its own grid and algorithm buffers for the whole batch
+        std::vector<std::unique_ptr<MazeGenerator>> generators(pool.Size());
+        for (auto& generator : generators) {
+            generator = std::make_unique<MazeGenerator>(options.width, options.height);
+            generator->SetAlgorithm(options.algorithm);
+            generator->SetRngKind(options.rng);
+        }
+
+        // One solver per worker as well, for --solve
+        std::vector<Solver> solvers(options.solve ? pool.Size() : 0);
+        std::vector<Solution> solutions(solvers.size());
+        std::atomic<size_t> unsolved(0);
+
+        auto generate = [&](size_t index, size_t worker) -> const Maze& {
+            MazeGenerator& generator = *generators[worker];
+            generator.GenerateSeeded(DeriveSeed(seed, index)); // mixes the batch seed and the index so neighbouring mazes are unrelated
+            generator.SetMazeName(mazeName(index));
+            if (options.solve && !solvers[worker].Solve(generator.GetMaze().m_Grid, options.solveMethod, solutions[worker])) {
+                unsolved++;
+            }
+            return generator.GetMaze();
+        };
+
+        // Adds one record in the selected format to an archive block
+        auto appendRecord = [&](const Maze& maze, std::vector<std::uint8_t>& out) {
+            if (!options.legacy) {
+                EncodeMaze(maze, out, options.compress);
+                return true;
+            }
+            std::ostringstream legacy;
+            if (!WriteLegacyMaze(legacy, maze)) return false;
+            const std::string bytes = legacy.str();
+            out.insert(out.end(), bytes.begin(), bytes.end());
+            return true;
+        };
+
+        std::atomic<size_t> failures(0);
+        auto start = std::chrono::steady_clock::now();
+
+        if (toArchive) {
+            // Mazes are generated in blocks; each worker fills a block into its own buffer and the buffers
+            // are written in index order. Working in waves of blocks keeps memory bounded for huge batches.
+            const size_t blockSize = 64;
+            const size_t blockCount = (options.count + blockSize - 1) / blockSize;
+            const size_t wave = pool.Size() * 4;
+            std::vector<std::vector<std::uint8_t>> buffers(wave);
+
+            for (size_t firstBlock = 0; firstBlock < blockCount; firstBlock += wave) {
+                const size_t blocks = std::min(wave, blockCount - firstBlock);
+
+                pool.ParallelFor(blocks, [&](size_t slot, size_t worker) {
+                    std::vector<std::uint8_t>& out = buffers[slot];
+                    out.clear(); // keeps the capacity from the previous wave
+                    const size_t begin = (firstBlock + slot) * blockSize;
+                    const size_t end = std::min(begin + blockSize, options.count);
+                    for (size_t index = begin; index < end; index++) {
+                        if (!appendRecord(generate(index, worker), out)) failures++;
+                    }
+                });
+
+                for (size_t slot = 0; slot < blocks; slot++) {
+                    archive.write(reinterpret_cast<const char*>(buffers[slot].data()), buffers[slot].size());
+                }
+            }
+
+            archive.flush();
+            if (!archive) failures++;
+        }
+        else {
+            pool.ParallelFor(options.count, [&](size_t index, size_t worker) {
+                const Maze& maze = generate(index, worker);
+                const std::string path = options.outDir + "/" + maze.m_Name + ".maze";
+                if (options.legacy) {
+                    std::ofstream file(path, std::ios::binary);
+                    if (!file || !WriteLegacyMaze(file, maze)) failures++;
+                }
+                else if (SaveMazeFile(path, maze, options.compress) != MazeError::None) {
+                    failures++;
+                }
+            });
+        }
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << "Generated " << options.count << " " << options.width << "x" << options.height << " "
+            << AlgorithmName(options.algorithm) << " mazes (seed " << seed << ", " << RngKindName(options.rng) << ") in " << seconds << "s"
+            << " - " << (seconds > 0 ? options.count / seconds : 0.0) << " mazes/s on " << pool.Size() << " thread(s)\n";
+
+        if (unsolved > 0) {
+            std::cerr << unsolved << " maze(s) have no path from the entrance to the exit!\n";
+            return 1;
+        }
+        if (failures > 0) {
+            std::cerr << failures << " maze(s) could not be written!\n";
+            return 1;
+        }
+        return 0;
+    }
+
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: checksum.cpp
+ * Description:
+ * Implements CRC-32 with the slicing-by-8 table method.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "checksum.h"
+
+namespace MazeGen {
+
+    /* Slicing-by-8
+
+        The classic table method handles one byte per lookup. Slicing-by-8 keeps 8 tables so that
+        8 bytes are folded into the checksum per step with 8 independent lookups, which is several
+        times faster on large payloads. The tables are built once on first use.
+    */
+    struct CrcTables {
+        std::uint32_t table[8][256];
+
+        CrcTables() {
+            for (std::uint32_t i = 0; i < 256; i++) {
+                std::uint32_t crc = i;
+                for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+                table[0][i] = crc;
+            }
+            for (std::uint32_t i = 0; i < 256; i++) {
+                for (int slice = 1; slice < 8; slice++) {
+                    table[slice][i] = (table[slice - 1][i] >> 8) ^ table[0][table[slice - 1][i] & 0xFFu];
+                }
+            }
+        }
+    };
+
+    static const CrcTables s_Crc;
+
+    std::uint32_t Crc32(const void* data, size_t size, std::uint32_t crc) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        crc = ~crc;
+
+        while (size >= 8) {
+            // Assemble little-endian words byte by byte so the result is the same on every platform
+            std::uint32_t low = crc ^ (std::uint32_t(bytes[0]) | std::uint32_t(bytes[1]) << 8 |
+                                       std::uint32_t(bytes[2]) << 16 | std::uint32_t(bytes[3]) << 24);
+            std::uint32_t high = std::uint32_t(bytes[4]) | std::uint32_t(bytes[5]) << 8 |
+                                 std::uint32_t(bytes[6]) << 16 | std::uint32_t(bytes[7]) << 24;
+
+            crc = s_Crc.table[7][low & 0xFFu] ^ s_Crc.table[6][(low >> 8) & 0xFFu] ^
+                  s_Crc.table[5][(low >> 16) & 0xFFu] ^ s_Crc.table[4][low >> 24] ^
+                  s_Crc.table[3][high & 0xFFu] ^ s_Crc.table[2][(high >> 8) & 0xFFu] ^
+                  s_Crc.table[1][(high >> 16) & 0xFFu] ^ s_Crc.table[0][high >> 24];
+
+            bytes += 8;
+            size -= 8;
+        }
+
+        while (size--) crc = (crc >> 8) ^ s_Crc.table[0][(crc ^ *bytes++) & 0xFFu];
+
+        return ~crc;
+    }
+
+}
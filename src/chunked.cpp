@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: chunked.cpp
+ * Description:
+ * Implements ChunkedMaze - deterministic chunk generation with hashed border
+ * openings and the LRU chunk cache.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "chunked.h"
+#include <algorithm>  // Used for std::min() and std::max()
+#include <iterator>   // Used for std::prev()
+
+namespace MazeGen {
+
+    // Separate hash streams, so a chunk seed never equals an edge hash
+    static const std::uint64_t kChunkTag = 0x6368756E6B000000ull;      // "chunk"
+    static const std::uint64_t kVerticalTag = 0x7665727465780000ull;   // border between (cx - 1, cy) and (cx, cy)
+    static const std::uint64_t kHorizontalTag = 0x686F72697A000000ull; // border between (cx, cy - 1) and (cx, cy)
+
+    // Rounds towards minus infinity, so -1 is in chunk -1 and not in chunk 0
+    static std::int64_t floorDiv(std::int64_t value, std::int64_t divisor) {
+        std::int64_t quotient = value / divisor;
+        return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+    }
+
+    static std::uint64_t hashCoords(std::uint64_t seed, std::uint64_t tag, std::int64_t x, std::int64_t y) {
+        return DeriveSeed(DeriveSeed(seed ^ tag, static_cast<std::uint64_t>(x)), static_cast<std::uint64_t>(y));
+    }
+
+    size_t ChunkedMaze::KeyHash::operator()(const std::pair<std::int64_t, std::int64_t>& key) const {
+        return static_cast<size_t>(DeriveSeed(static_cast<std::uint64_t>(key.first), static_cast<std::uint64_t>(key.second)));
+    }
+
+    ChunkedMaze::ChunkedMaze(std::uint64_t seed, int chunkCells, size_t maxChunks, Algorithm algorithm, RngKind rngKind)
+        : m_Seed(seed), m_ChunkCells(std::max(chunkCells, 1)), m_MaxChunks(std::max<size_t>(maxChunks, 1)),
+          m_Algorithm(algorithm), m_RngKind(rngKind), m_Engine(CreateAlgorithm(algorithm)) {
+        if (!m_Engine) {
+            m_Algorithm = Algorithm::Backtracker;
+            m_Engine = CreateAlgorithm(m_Algorithm);
+        }
+        m_Index.reserve(m_MaxChunks); // the index never rehashes
+    }
+
+    int ChunkedMaze::edgeOpening(std::uint64_t tag, std::int64_t ex, std::int64_t ey) const {
+        // Multiply-shift maps the top 32 hash bits onto [0, chunkCells)
+        std::uint64_t hash = hashCoords(m_Seed, tag, ex, ey) >> 32;
+        return static_cast<int>((hash * static_cast<std::uint64_t>(m_ChunkCells)) >> 32);
+    }
+
+    void ChunkedMaze::generate(Entry& entry) {
+        const int size = 2 * m_ChunkCells + 1;
+        Grid& grid = entry.grid;
+        grid.Assign(size, size, true); // reuses the evicted chunk's buffer
+
+        // The chunk's own cells - seeded only by (seed, cx, cy), so it comes out the same every time
+        Rng rng(hashCoords(m_Seed, kChunkTag, entry.cx, entry.cy), m_RngKind);
+        m_Engine->Carve(grid, CellRegion::Full(size, size), rng);
+
+        // One opening per border, decided by the border itself (see chunked.h)
+        const int last = size - 1;
+        grid.SetPassage(0, 2 * edgeOpening(kVerticalTag, entry.cx, entry.cy) + 1);        // left
+        grid.SetPassage(last, 2 * edgeOpening(kVerticalTag, entry.cx + 1, entry.cy) + 1); // right
+        grid.SetPassage(2 * edgeOpening(kHorizontalTag, entry.cx, entry.cy) + 1, 0);       // top
+        grid.SetPassage(2 * edgeOpening(kHorizontalTag, entry.cx, entry.cy + 1) + 1, last); // bottom
+
+        m_Generated++;
+    }
+
+    ChunkedMaze::Entry& ChunkedMaze::lookup(std::int64_t cx, std::int64_t cy) {
+        // Most lookups hit the chunk used last - no hashing needed for those
+        if (!m_Chunks.empty() && m_Chunks.front().cx == cx && m_Chunks.front().cy == cy) return m_Chunks.front();
+
+        auto found = m_Index.find({ cx, cy });
+        if (found != m_Index.end()) {
+            m_Chunks.splice(m_Chunks.begin(), m_Chunks, found->second); // now the most recently used
+            return m_Chunks.front();
+        }
+
+        if (m_Chunks.size() < m_MaxChunks) {
+            m_Chunks.emplace_front();
+        }
+        else {
+            // Evict the least recently used chunk and generate the new one into its entry
+            m_Index.erase({ m_Chunks.back().cx, m_Chunks.back().cy });
+            m_Chunks.splice(m_Chunks.begin(), m_Chunks, std::prev(m_Chunks.end()));
+        }
+
+        Entry& entry = m_Chunks.front();
+        entry.cx = cx;
+        entry.cy = cy;
+        generate(entry);
+        m_Index[{ cx, cy }] = m_Chunks.begin();
+        return entry;
+    }
+
+    const Grid& ChunkedMaze::Chunk(std::int64_t cx, std::int64_t cy) {
+        return lookup(cx, cy).grid;
+    }
+
+    bool ChunkedMaze::IsWall(std::int64_t x, std::int64_t y) {
+        const std::int64_t stride = ChunkStride();
+        const std::int64_t cx = floorDiv(x, stride), cy = floorDiv(y, stride);
+        return lookup(cx, cy).grid.IsWall(static_cast<int>(x - cx * stride), static_cast<int>(y - cy * stride));
+    }
+
+    void ChunkedMaze::CopyWindow(std::int64_t x, std::int64_t y, int width, int height, Grid& out) {
+        out.Assign(width, height, true);
+        if (out.Empty()) return;
+
+        const std::int64_t stride = ChunkStride();
+        for (int row = 0; row < height; row++) {
+            const std::int64_t gy = y + row;
+            const std::int64_t cy = floorDiv(gy, stride);
+            const int localY = static_cast<int>(gy - cy * stride);
+
+            // Walk the row one chunk at a time - one lookup per chunk instead of one per cell
+            for (int col = 0; col < width;) {
+                const std::int64_t gx = x + col;
+                const std::int64_t cx = floorDiv(gx, stride);
+                const int localX = static_cast<int>(gx - cx * stride);
+                const int span = std::min(width - col, static_cast<int>(stride) - localX);
+
+                const Grid& chunk = lookup(cx, cy).grid;
+                for (int i = 0; i < span; i++) {
+                    if (!chunk.IsWall(localX + i, localY)) out.SetPassage(col + i, row);
+                }
+                col += span;
+            }
+        }
+    }
+
+}
@@ -0,0 +1,138 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: compress.cpp
+ * Description:
+ * Implements the LZ77 block compressor and decompressor.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "compress.h"
+#include <cstring> // Used for std::memcpy()
+
+namespace MazeGen {
+
+    static constexpr size_t kMinMatch = 4;      // shorter matches cost more than the literals they replace
+    static constexpr size_t kMaxOffset = 65535; // offsets are stored in 2 bytes
+    static constexpr int kHashBits = 14;        // 16K entry table - 64 KB, fits in L2
+
+    static std::uint32_t read32(const std::uint8_t* p) {
+        std::uint32_t value;
+        std::memcpy(&value, p, sizeof(value)); // only compared for equality, so byte order does not matter
+        return value;
+    }
+
+    static std::uint32_t hash32(std::uint32_t value) {
+        return (value * 2654435761u) >> (32 - kHashBits); // Knuth's multiplicative hash
+    }
+
+    // Writes the 255, 255, ..., rest tail of a length that did not fit in its 4 bit nibble
+    static void putLength(std::vector<std::uint8_t>& out, size_t length) {
+        for (; length >= 255; length -= 255) out.push_back(255);
+        out.push_back(static_cast<std::uint8_t>(length));
+    }
+
+    static void putSequence(std::vector<std::uint8_t>& out, const std::uint8_t* literals, size_t literalCount,
+                            size_t offset, size_t matchLength) {
+        const size_t matchCode = matchLength ? matchLength - kMinMatch : 0;
+        const std::uint8_t token = static_cast<std::uint8_t>(((literalCount < 15 ? literalCount : 15) << 4) |
+                                                             (matchCode < 15 ? matchCode : 15));
+        out.push_back(token);
+        if (literalCount >= 15) putLength(out, literalCount - 15);
+        out.insert(out.end(), literals, literals + literalCount);
+
+        if (matchLength == 0) return; // last sequence - literals only
+
+        out.push_back(static_cast<std::uint8_t>(offset & 0xFFu));
+        out.push_back(static_cast<std::uint8_t>(offset >> 8));
+        if (matchCode >= 15) putLength(out, matchCode - 15);
+    }
+
+    void CompressBlock(const std::uint8_t* data, size_t size, std::vector<std::uint8_t>& out) {
+        out.clear();
+        out.reserve(size + size / 255 + 16); // worst case: everything is literals
+
+        std::vector<std::uint32_t> table(size_t(1) << kHashBits, 0); // last position seen for each hash
+
+        size_t pos = 0, anchor = 0; // anchor = first byte not yet written out
+        while (size >= kMinMatch && pos + kMinMatch <= size) {
+            const std::uint32_t sequence = read32(data + pos);
+            const std::uint32_t hash = hash32(sequence);
+            const size_t candidate = table[hash];
+            table[hash] = static_cast<std::uint32_t>(pos);
+
+            if (candidate < pos && pos - candidate <= kMaxOffset && read32(data + candidate) == sequence) {
+                size_t length = kMinMatch;
+                while (pos + length < size && data[candidate + length] == data[pos + length]) length++;
+
+                putSequence(out, data + anchor, pos - anchor, pos - candidate, length);
+                pos += length;
+                anchor = pos;
+                continue;
+            }
+
+            // Skip ahead faster the longer nothing has matched, so data that does not compress is passed
+            // over quickly instead of being hashed byte by byte
+            pos += 1 + ((pos - anchor) >> 6);
+        }
+
+        putSequence(out, data + anchor, size - anchor, 0, 0);
+    }
+
+    // Reads the 255, 255, ..., rest tail of a length. Returns false if the input ends first.
+    static bool getLength(const std::uint8_t*& in, const std::uint8_t* end, size_t& length) {
+        std::uint8_t byte;
+        do {
+            if (in == end) return false;
+            byte = *in++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+
+    bool DecompressBlock(const std::uint8_t* data, size_t size, std::uint8_t* out, size_t outSize) {
+        const std::uint8_t* in = data;
+        const std::uint8_t* const end = data + size;
+        size_t written = 0;
+
+        while (in < end) {
+            const std::uint8_t token = *in++;
+
+            size_t literalCount = token >> 4;
+            if (literalCount == 15 && !getLength(in, end, literalCount)) return false;
+            if (literalCount > static_cast<size_t>(end - in) || literalCount > outSize - written) return false;
+            if (literalCount > 0) std::memcpy(out + written, in, literalCount);
+            in += literalCount;
+            written += literalCount;
+
+            if (in == end) break; // the last sequence has no match
+
+            if (end - in < 2) return false;
+            const size_t offset = size_t(in[0]) | size_t(in[1]) << 8;
+            in += 2;
+
+            size_t matchLength = token & 0x0Fu;
+            if (matchLength == 15 && !getLength(in, end, matchLength)) return false;
+            matchLength += kMinMatch;
+
+            if (offset == 0 || offset > written || matchLength > outSize - written) return false;
+
+            // Byte by byte on purpose: when offset < length the match overlaps the bytes it is producing,
+            // which is how a short pattern is repeated many times
+            const std::uint8_t* from = out + written - offset;
+            for (size_t i = 0; i < matchLength; i++) out[written + i] = from[i];
+            written += matchLength;
+        }
+
+        return written == outSize;
+    }
+
+}
@@ -0,0 +1,495 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: deflate.cpp
+ * Description:
+ * Implements the streaming DEFLATE encoder (LZ77 with hash chains, per-block
+ * Huffman codes) and its zlib framing.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "deflate.h"
+#include <algorithm>
+#include <cstring> // Used for std::memcpy() and std::memmove()
+
+namespace MazeGen {
+
+    static const size_t kWindowSize = 32768;     // farthest a match may reach back
+    static const size_t kBufferSize = 4 * kWindowSize;
+    static const size_t kMinMatch = 3, kMaxMatch = 258;
+    static const int kHashBits = 15;
+    static const int kMaxChain = 16;             // earlier positions tried per match - speed over the last few percent
+    static const size_t kMaxInsert = 32;         // longer matches only hash their first position (like zlib's fast levels)
+    static const size_t kBlockSymbols = 32768;   // literals and matches per block
+    static const std::uint32_t kAdlerModulo = 65521;
+
+    static const int kLiteralSymbols = 286, kDistanceSymbols = 30, kLengthSymbols = 19;
+    static const int kEndOfBlock = 256;
+    static const int kMaxCodeBits = 15, kMaxLengthCodeBits = 7;
+
+    // The order code length code lengths are sent in - the ones most likely to be 0 come last
+    static const std::uint8_t kLengthCodeOrder[kLengthSymbols] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    // Codes are sent starting with their highest bit, the rest of the stream lowest bit first
+    static unsigned reverseBits(unsigned code, unsigned bits) {
+        unsigned reversed = 0;
+        for (unsigned i = 0; i < bits; i++) reversed |= ((code >> i) & 1u) << (bits - 1 - i);
+        return reversed;
+    }
+
+    /* Huffman Codes
+        A code is fully described by the bit length of every symbol (RFC 1951 section 3.2.2): symbols
+        of the same length get consecutive codes, in symbol order, shorter lengths first. That is all
+        a dynamic block has to send, and all Build needs.
+    */
+    struct HuffmanCode {
+        std::uint16_t code[kLiteralSymbols + 2]; // bit reversed, ready for putBits
+        std::uint8_t bits[kLiteralSymbols + 2];
+
+        void Build(const std::uint8_t* lengths, int count) {
+            int lengthCount[kMaxCodeBits + 1] = {};
+            for (int symbol = 0; symbol < count; symbol++) lengthCount[lengths[symbol]]++;
+            lengthCount[0] = 0;
+
+            unsigned next[kMaxCodeBits + 1] = {}; // first code of every length
+            for (int length = 1; length <= kMaxCodeBits; length++) next[length] = (next[length - 1] + lengthCount[length - 1]) << 1;
+            for (int symbol = 0; symbol < count; symbol++) {
+                bits[symbol] = lengths[symbol];
+                code[symbol] = lengths[symbol] ? static_cast<std::uint16_t>(reverseBits(next[lengths[symbol]]++, lengths[symbol])) : 0;
+            }
+        }
+    };
+
+    /* Code Lengths From Counts
+        An ordinary Huffman tree gives the best lengths, but DEFLATE allows at most 15 bits (7 for the
+        code length code). When the tree is deeper, the lengths are squeezed the way miniz does it:
+        everything too long becomes the limit, then codes are moved down a level until the lengths
+        describe a complete code again. The most frequent symbols keep the shortest lengths.
+    */
+    static void buildLengths(const std::uint32_t* counts, int count, int limit, std::uint8_t* lengths) {
+        struct Node {
+            std::uint64_t weight;
+            int parent;
+        };
+
+        std::fill(lengths, lengths + count, 0);
+        std::vector<int> used; // symbols that occur, rarest first
+        for (int symbol = 0; symbol < count; symbol++) {
+            if (counts[symbol]) used.push_back(symbol);
+        }
+        if (used.empty()) return;
+        if (used.size() == 1) {
+            lengths[used[0]] = 1; // a single code still needs one bit
+            return;
+        }
+        std::stable_sort(used.begin(), used.end(), [&](int a, int b) { return counts[a] < counts[b]; });
+
+        // Two queue Huffman: leaves sorted by weight, merged nodes come out sorted by construction
+        const size_t leaves = used.size();
+        std::vector<Node> nodes(2 * leaves - 1);
+        for (size_t i = 0; i < leaves; i++) nodes[i] = { counts[used[i]], -1 };
+        size_t nextLeaf = 0, nextMerged = leaves;
+        auto takeLightest = [&](size_t created) {
+            if (nextLeaf < leaves && (nextMerged == created || nodes[nextLeaf].weight <= nodes[nextMerged].weight)) return nextLeaf++;
+            return nextMerged++;
+        };
+        for (size_t created = leaves; created < nodes.size(); created++) {
+            const size_t a = takeLightest(created), b = takeLightest(created);
+            nodes[created] = { nodes[a].weight + nodes[b].weight, -1 };
+            nodes[a].parent = nodes[b].parent = static_cast<int>(created);
+        }
+
+        // Depth of every leaf, counted per length
+        std::vector<int> depth(nodes.size(), 0);
+        int lengthCount[64] = {};
+        for (size_t i = nodes.size() - 1; i-- > 0;) depth[i] = depth[nodes[i].parent] + 1;
+        for (size_t i = 0; i < leaves; i++) lengthCount[std::min(depth[i], limit)]++;
+
+        // Too deep: the clamped lengths overfill the code space, move codes down until they fit
+        std::uint64_t total = 0;
+        for (int length = 1; length <= limit; length++) total += static_cast<std::uint64_t>(lengthCount[length]) << (limit - length);
+        while (total > (std::uint64_t(1) << limit)) {
+            lengthCount[limit]--;
+            for (int length = limit - 1; length > 0; length--) {
+                if (lengthCount[length]) {
+                    lengthCount[length]--;
+                    lengthCount[length + 1] += 2;
+                    break;
+                }
+            }
+            total--;
+        }
+
+        // Longest lengths to the rarest symbols
+        size_t next = 0;
+        for (int length = limit; length > 0; length--) {
+            for (int i = 0; i < lengthCount[length]; i++) lengths[used[next++]] = static_cast<std::uint8_t>(length);
+        }
+    }
+
+    /* Symbol Tables (RFC 1951 section 3.2.5)
+        Match lengths 3-258 map to length symbols 257-285 and distances 1-32768 to distance symbols
+        0-29, each followed by a few extra bits. The fixed code of section 3.2.6 is built here too:
+        literal/length symbols 0-143 use 8 bits, 144-255 9 bits, 256-279 7 bits and 280-287 8 bits,
+        distance symbols all use 5 bits.
+    */
+    struct DeflateTables {
+        HuffmanCode fixedLiterals;
+        HuffmanCode fixedDistances;
+
+        std::uint8_t lengthSymbol[kMaxMatch + 1]; // length 3-258 -> symbol 257-285 (stored as symbol - 257)
+        std::uint8_t distanceSymbol[512];         // see distanceSymbolOf
+
+        DeflateTables() {
+            std::uint8_t lengths[288];
+            for (int symbol = 0; symbol < 288; symbol++) lengths[symbol] = symbol < 144 ? 8 : symbol < 256 ? 9 : symbol < 280 ? 7 : 8;
+            fixedLiterals.Build(lengths, 288);
+            std::fill(lengths, lengths + kDistanceSymbols, 5);
+            fixedDistances.Build(lengths, kDistanceSymbols);
+
+            for (unsigned symbol = 0; symbol < 29; symbol++) {
+                const unsigned last = (symbol == 28) ? kMaxMatch : kLengthBase[symbol] + (1u << kLengthExtra[symbol]) - 1;
+                for (unsigned length = kLengthBase[symbol]; length <= last && length <= kMaxMatch; length++) {
+                    lengthSymbol[length] = static_cast<std::uint8_t>(symbol);
+                }
+            }
+
+            for (unsigned symbol = 0; symbol < 30; symbol++) {
+                const unsigned first = kDistanceBase[symbol], last = first + (1u << kDistanceExtra[symbol]) - 1;
+                for (unsigned distance = first; distance <= last; distance++) {
+                    const unsigned index = (distance - 1) < 256 ? distance - 1 : 256 + ((distance - 1) >> 7);
+                    distanceSymbol[index] = static_cast<std::uint8_t>(symbol);
+                }
+            }
+        }
+
+        // Distances up to 256 have their own entry, longer ones share one per 128 (those codes all start at (n * 128) + 1)
+        unsigned distanceSymbolOf(std::uint64_t distance) const {
+            return distance <= 256 ? distanceSymbol[distance - 1] : distanceSymbol[256 + ((distance - 1) >> 7)];
+        }
+
+        static constexpr std::uint16_t kLengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                                          35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+        static constexpr std::uint8_t kLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                                          3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+        static constexpr std::uint16_t kDistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                                            257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                                            8193, 12289, 16385, 24577 };
+        static constexpr std::uint8_t kDistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                                            7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+    };
+
+    static const DeflateTables& deflateTables() {
+        static const DeflateTables tables; // built once, on first use
+        return tables;
+    }
+
+    /* Dynamic Block Header
+        The literal/length and distance code lengths are sent as one list, itself compressed: runs of
+        the same length become symbol 16 (repeat the previous length 3-6 times), runs of zeros symbols
+        17 (3-10) and 18 (11-138). Those 19 symbols get a small Huffman code of their own, whose lengths
+        go first, 3 bits each.
+    */
+    struct BlockHeader {
+        std::uint8_t lengths[kLiteralSymbols + kDistanceSymbols]; // literal lengths, then distance lengths
+        int literalCount = 0, distanceCount = 0;                  // lengths actually sent (trailing zeros are left off)
+
+        std::vector<std::uint16_t> runs; // (extra value << 5) | length symbol
+        std::uint32_t lengthCounts[kLengthSymbols] = {};
+        std::uint8_t lengthBits[kLengthSymbols] = {};
+        HuffmanCode lengthCode;
+        int lengthCodeCount = 4; // code length code lengths sent, at least 4
+
+        BlockHeader(const std::uint8_t* literalLengths, const std::uint8_t* distanceLengths) {
+            literalCount = kLiteralSymbols;
+            while (literalCount > 257 && literalLengths[literalCount - 1] == 0) literalCount--;
+            distanceCount = kDistanceSymbols;
+            while (distanceCount > 1 && distanceLengths[distanceCount - 1] == 0) distanceCount--;
+            std::copy(literalLengths, literalLengths + literalCount, lengths);
+            std::copy(distanceLengths, distanceLengths + distanceCount, lengths + literalCount);
+
+            const int total = literalCount + distanceCount;
+            for (int i = 0; i < total;) {
+                const std::uint8_t length = lengths[i];
+                int run = 1;
+                while (i + run < total && lengths[i + run] == length) run++;
+
+                if (length == 0 && run >= 3) {
+                    run = std::min(run, 138);
+                    addRun(run <= 10 ? 17 : 18, run <= 10 ? run - 3 : run - 11);
+                }
+                else if (length != 0 && run >= 4) {
+                    addRun(length, 0); // the length itself, then repeats of it
+                    run = std::min(run - 1, 6);
+                    addRun(16, run - 3);
+                    run++;
+                }
+                else {
+                    run = 1;
+                    addRun(length, 0);
+                }
+                i += run;
+            }
+
+            buildLengths(lengthCounts, kLengthSymbols, kMaxLengthCodeBits, lengthBits);
+            lengthCode.Build(lengthBits, kLengthSymbols);
+            lengthCodeCount = kLengthSymbols;
+            while (lengthCodeCount > 4 && lengthBits[kLengthCodeOrder[lengthCodeCount - 1]] == 0) lengthCodeCount--;
+        }
+
+        void addRun(int symbol, int extra) {
+            runs.push_back(static_cast<std::uint16_t>((extra << 5) | symbol));
+            lengthCounts[symbol]++;
+        }
+
+        static int extraBits(int symbol) { return symbol == 16 ? 2 : symbol == 17 ? 3 : symbol == 18 ? 7 : 0; }
+
+        std::uint64_t Cost() const {
+            std::uint64_t bits = 5 + 5 + 4 + 3 * static_cast<std::uint64_t>(lengthCodeCount);
+            for (std::uint16_t run : runs) bits += lengthBits[run & 31] + extraBits(run & 31);
+            return bits;
+        }
+    };
+
+    ZlibWriter::ZlibWriter()
+        : m_Buffer(kBufferSize), m_Head(size_t(1) << kHashBits, -1), m_Prev(kWindowSize, -1),
+          m_LiteralCounts(kLiteralSymbols, 0), m_DistanceCounts(kDistanceSymbols, 0) {
+        m_Symbols.reserve(kBlockSymbols);
+        m_Out.reserve(64 * 1024);
+        m_Out.push_back(0x78); // deflate, 32 KB window
+        m_Out.push_back(0x01); // no preset dictionary, header check bits ((0x78 << 8) | 0x01 is a multiple of 31)
+    }
+
+    void ZlibWriter::Write(const std::uint8_t* data, size_t size) {
+        // Adler-32 of the uncompressed data - the sums are reduced before they can overflow 32 bits
+        for (size_t done = 0; done < size;) {
+            const size_t run = std::min<size_t>(size - done, 5552);
+            for (size_t i = 0; i < run; i++) {
+                m_AdlerA += data[done + i];
+                m_AdlerB += m_AdlerA;
+            }
+            m_AdlerA %= kAdlerModulo;
+            m_AdlerB %= kAdlerModulo;
+            done += run;
+        }
+
+        while (size > 0) {
+            if (m_End - m_Base == kBufferSize) slide();
+            const size_t room = kBufferSize - static_cast<size_t>(m_End - m_Base);
+            const size_t count = std::min(room, size);
+            std::memcpy(m_Buffer.data() + (m_End - m_Base), data, count);
+            m_End += count;
+            data += count;
+            size -= count;
+            compress(false);
+        }
+    }
+
+    void ZlibWriter::Finish() {
+        if (m_Finished) return;
+        m_Finished = true;
+
+        compress(true);
+        writeBlock(true);
+
+        while (m_BitCount > 0) { // pad to a whole byte
+            m_Out.push_back(static_cast<std::uint8_t>(m_BitBuffer));
+            m_BitBuffer >>= 8;
+            m_BitCount = std::max(m_BitCount - 8, 0);
+        }
+
+        const std::uint32_t adler = (m_AdlerB << 16) | m_AdlerA; // big-endian, like every zlib number
+        for (int shift = 24; shift >= 0; shift -= 8) m_Out.push_back(static_cast<std::uint8_t>(adler >> shift));
+    }
+
+    void ZlibWriter::slide() {
+        // Keep one window of history before the next byte to code, plus everything not coded yet
+        const std::uint64_t keep = std::max(m_Base, m_Pos > kWindowSize ? m_Pos - kWindowSize : 0);
+        std::memmove(m_Buffer.data(), m_Buffer.data() + (keep - m_Base), static_cast<size_t>(m_End - keep));
+        m_Base = keep;
+    }
+
+    void ZlibWriter::insertHash(std::uint64_t pos) {
+        const std::uint8_t* p = m_Buffer.data() + (pos - m_Base);
+        const std::uint32_t key = (std::uint32_t(p[0]) << 16) | (std::uint32_t(p[1]) << 8) | p[2];
+        const std::uint32_t hash = (key * 2654435761u) >> (32 - kHashBits);
+        m_Prev[pos & (kWindowSize - 1)] = m_Head[hash];
+        m_Head[hash] = static_cast<std::int64_t>(pos);
+    }
+
+    // Bytes that agree at p and q, up to limit - compared 8 at a time
+    static size_t matchLength(const std::uint8_t* p, const std::uint8_t* q, size_t limit) {
+        size_t length = 0;
+        while (length + 8 <= limit) {
+            std::uint64_t a, b;
+            std::memcpy(&a, p + length, 8);
+            std::memcpy(&b, q + length, 8);
+            if (a != b) break; // the difference is somewhere in these 8 bytes
+            length += 8;
+        }
+        while (length < limit && p[length] == q[length]) length++;
+        return length;
+    }
+
+    size_t ZlibWriter::findMatch(std::uint64_t pos, size_t available, std::uint64_t& distance) const {
+        const std::uint8_t* p = m_Buffer.data() + (pos - m_Base);
+        const std::uint32_t key = (std::uint32_t(p[0]) << 16) | (std::uint32_t(p[1]) << 8) | p[2];
+        const std::uint32_t hash = (key * 2654435761u) >> (32 - kHashBits);
+
+        const size_t limit = std::min(available, kMaxMatch);
+        const std::uint64_t oldest = std::max(m_Base, pos > kWindowSize ? pos - kWindowSize : 0);
+
+        size_t best = 0;
+        std::int64_t candidate = m_Head[hash];
+        for (int chain = 0; chain < kMaxChain && candidate >= 0 && static_cast<std::uint64_t>(candidate) >= oldest; chain++) {
+            const std::uint8_t* q = m_Buffer.data() + (static_cast<std::uint64_t>(candidate) - m_Base);
+            if (q[best] == p[best]) { // cannot beat the best match unless this byte agrees
+                size_t length = matchLength(p, q, limit);
+                if (length > best) {
+                    best = length;
+                    distance = pos - static_cast<std::uint64_t>(candidate);
+                    if (best == limit) break;
+                }
+            }
+            const std::int64_t next = m_Prev[static_cast<std::uint64_t>(candidate) & (kWindowSize - 1)];
+            if (next >= candidate) break; // the slot was reused by a newer position - the chain ends here
+            candidate = next;
+        }
+        return best >= kMinMatch ? best : 0;
+    }
+
+    void ZlibWriter::addLiteral(std::uint8_t value) {
+        m_Symbols.push_back(value);
+        m_LiteralCounts[value]++;
+        if (m_Symbols.size() == kBlockSymbols) writeBlock(false);
+    }
+
+    void ZlibWriter::addMatch(size_t length, std::uint64_t distance) {
+        const DeflateTables& tables = deflateTables();
+        m_Symbols.push_back(static_cast<std::uint32_t>((distance << 9) | length));
+        m_LiteralCounts[257 + tables.lengthSymbol[length]]++;
+        m_DistanceCounts[tables.distanceSymbolOf(distance)]++;
+        if (m_Symbols.size() == kBlockSymbols) writeBlock(false);
+    }
+
+    void ZlibWriter::writeBlock(bool final) {
+        const DeflateTables& tables = deflateTables();
+        m_LiteralCounts[kEndOfBlock]++;
+
+        // Codes for this block. Some decoders reject a distance code with fewer than two symbols, so give it two.
+        std::uint8_t literalLengths[kLiteralSymbols], distanceLengths[kDistanceSymbols];
+        buildLengths(m_LiteralCounts.data(), kLiteralSymbols, kMaxCodeBits, literalLengths);
+        int distancesUsed = 0;
+        for (int symbol = 0; symbol < kDistanceSymbols; symbol++) distancesUsed += m_DistanceCounts[symbol] != 0;
+        for (int symbol = 0; distancesUsed < 2; symbol++) {
+            if (m_DistanceCounts[symbol] == 0) {
+                m_DistanceCounts[symbol] = 1;
+                distancesUsed++;
+            }
+        }
+        buildLengths(m_DistanceCounts.data(), kDistanceSymbols, kMaxCodeBits, distanceLengths);
+        const BlockHeader header(literalLengths, distanceLengths);
+
+        // Bits for the symbols with either code - extra bits are the same for both and left out
+        std::uint64_t dynamicBits = header.Cost(), fixedBits = 0;
+        for (int symbol = 0; symbol < kLiteralSymbols; symbol++) {
+            dynamicBits += static_cast<std::uint64_t>(m_LiteralCounts[symbol]) * literalLengths[symbol];
+            fixedBits += static_cast<std::uint64_t>(m_LiteralCounts[symbol]) * tables.fixedLiterals.bits[symbol];
+        }
+        for (int symbol = 0; symbol < kDistanceSymbols; symbol++) {
+            dynamicBits += static_cast<std::uint64_t>(m_DistanceCounts[symbol]) * distanceLengths[symbol];
+            fixedBits += static_cast<std::uint64_t>(m_DistanceCounts[symbol]) * 5;
+        }
+
+        HuffmanCode dynamicLiterals, dynamicDistances;
+        const HuffmanCode* literals = &tables.fixedLiterals;
+        const HuffmanCode* distances = &tables.fixedDistances;
+        putBits(final ? 1 : 0, 1);
+        if (dynamicBits < fixedBits) {
+            putBits(2, 2);
+            putBits(static_cast<std::uint32_t>(header.literalCount - 257), 5);
+            putBits(static_cast<std::uint32_t>(header.distanceCount - 1), 5);
+            putBits(static_cast<std::uint32_t>(header.lengthCodeCount - 4), 4);
+            for (int i = 0; i < header.lengthCodeCount; i++) putBits(header.lengthBits[kLengthCodeOrder[i]], 3);
+            for (std::uint16_t run : header.runs) {
+                const int symbol = run & 31;
+                putBits(header.lengthCode.code[symbol], header.lengthCode.bits[symbol]);
+                if (BlockHeader::extraBits(symbol)) putBits(run >> 5, BlockHeader::extraBits(symbol));
+            }
+
+            dynamicLiterals.Build(literalLengths, kLiteralSymbols);
+            dynamicDistances.Build(distanceLengths, kDistanceSymbols);
+            literals = &dynamicLiterals;
+            distances = &dynamicDistances;
+        }
+        else {
+            putBits(1, 2);
+        }
+
+        for (std::uint32_t symbol : m_Symbols) {
+            if (symbol < 256) {
+                putBits(literals->code[symbol], literals->bits[symbol]);
+                continue;
+            }
+
+            const size_t length = symbol & 511;
+            const std::uint32_t distance = symbol >> 9;
+            const unsigned lengthSymbol = tables.lengthSymbol[length];
+            putBits(literals->code[257 + lengthSymbol], literals->bits[257 + lengthSymbol]);
+            if (DeflateTables::kLengthExtra[lengthSymbol] > 0) {
+                putBits(static_cast<std::uint32_t>(length - DeflateTables::kLengthBase[lengthSymbol]), DeflateTables::kLengthExtra[lengthSymbol]);
+            }
+
+            const unsigned distanceSymbol = tables.distanceSymbolOf(distance);
+            putBits(distances->code[distanceSymbol], distances->bits[distanceSymbol]);
+            if (DeflateTables::kDistanceExtra[distanceSymbol] > 0) {
+                putBits(distance - DeflateTables::kDistanceBase[distanceSymbol], DeflateTables::kDistanceExtra[distanceSymbol]);
+            }
+        }
+        putBits(literals->code[kEndOfBlock], literals->bits[kEndOfBlock]);
+
+        m_Symbols.clear();
+        std::fill(m_LiteralCounts.begin(), m_LiteralCounts.end(), 0);
+        std::fill(m_DistanceCounts.begin(), m_DistanceCounts.end(), 0);
+    }
+
+    void ZlibWriter::compress(bool flush) {
+        // Without flush, stop while a full length match could still grow with the next Write
+        const std::uint64_t stop = flush ? m_End : (m_End >= kMaxMatch ? m_End - kMaxMatch : 0);
+
+        while (m_Pos < stop) {
+            const size_t available = static_cast<size_t>(m_End - m_Pos);
+            std::uint64_t distance = 0;
+            const size_t length = available >= kMinMatch ? findMatch(m_Pos, available, distance) : 0;
+
+            if (length == 0) {
+                addLiteral(m_Buffer[static_cast<size_t>(m_Pos - m_Base)]);
+                if (available >= kMinMatch) insertHash(m_Pos);
+                m_Pos++;
+                continue;
+            }
+
+            addMatch(length, distance);
+            // Positions of a short match go into the hash chains, so later matches can start inside it.
+            // A long match (a run of walls) is almost always followed by more of the same, its start is enough.
+            const std::uint64_t end = m_Pos + length;
+            if (length > kMaxInsert) {
+                insertHash(m_Pos);
+                m_Pos = end;
+                continue;
+            }
+            for (; m_Pos < end; m_Pos++) {
+                if (m_End - m_Pos >= kMinMatch) insertHash(m_Pos);
+            }
+        }
+    }
+
+}
@@ -12,11 +12,16 @@
  * Version: v1.0.1
  * Author: Ghost
  * Created On: 02-14-2025
- * Last Modified: 02-21-2025
+ * Last Modified: 10-17-2026
  *****************************************************************************/
 
 #include "driver.h"
-#include "maze_gen.h"     // Used for creating the maze grid as a 2D matrix (std::vector<std::vector>)
+#include "maze_gen.h"     // MazeGenerator - generates, displays, saves and loads mazes
+#include "batch.h"        // Non-interactive batch generation
+#include "serve.h"        // Generation service and its client
+#include "chunked.h"      // Infinite maze made of chunks
+#include "export.h"       // Image and graph export
+#include "maze_io.h"      // LoadMaze for the export command
 #include <iostream>
 #include <string>
 
@@ -32,6 +37,13 @@ namespace MazeGen {
     }
 
     // CHANGE - removed inline keyword. They have no effect due to compiler optimization which will do what inline is attempting to do.
+    // Prints what went wrong, if anything. Returns true on success.
+    bool report(MazeError error) {
+        if (error == MazeError::None) return true;
+        std::cout << MazeErrorMessage(error) << '\n';
+        return false;
+    }
+
     bool validateInput() {
         // Inline functions are not real functions, wherever this is called, the contents in this scope are copied to that location.
         if (std::cin.fail()) {
@@ -43,6 +55,35 @@ namespace MazeGen {
         return true;
     }
 
+    // Walks around an infinite maze one screen at a time until the user goes back to the menu
+    void exploreInfinite(const MazeGenerator& generator, std::uint64_t seed) {
+        static const int kViewWidth = 61, kViewHeight = 21;
+
+        // Only the chunks around the view are ever kept - the cache holds a few screens worth
+        ChunkedMaze maze(seed, 16, 64, generator.GetAlgorithm(), generator.GetRngKind());
+        std::int64_t x = 0, y = 0; // top left of the view in grid coordinates, kept even so cells stay on odd columns
+        Grid view;
+
+        std::string move;
+        do {
+            clearScreen();
+            maze.CopyWindow(x, y, kViewWidth, kViewHeight, view);
+            OutputBuffer out(stdout);
+            RenderGrid(view, out, generator.GetRenderOptions());
+            out.Flush();
+
+            std::cout << "\nPosition (" << x << ", " << y << ") - " << maze.CachedChunks() << " of " << maze.MaxChunks()
+                << " chunks cached, " << maze.GeneratedChunks() << " generated\n";
+            std::cout << "Move (w = up, a = left, s = down, d = right, q = back to menu): ";
+            std::cin >> move;
+
+            if (move == "w") y -= 10;
+            else if (move == "s") y += 10;
+            else if (move == "a") x -= 20;
+            else if (move == "d") x += 20;
+        } while (std::cin && move != "q");
+    }
+
     void displayMenu() {
         // R and () allows formating strings, exactly as shown in IDE (hence the string pushed all the way to left)
         std::cout << R"(
@@ -52,10 +93,160 @@ Maze Generator
     3. Display Maze
     4. Save Maze
     5. Load Maze
-    6. Exit
+    6. Choose Algorithm
+    7. Stream Maze to File (large mazes)
+    8. Set Thread Count
+    9. Set Seed
+    10. Display Style
+    11. Solve Maze
+    12. Show Statistics
+    13. Regenerate Region
+    14. Explore Infinite Maze
+    15. Export Maze (PBM, PNG, edge list, CSR)
+    16. Exit
 Choose an option: )";
     }
 
+    void printUsage() {
+        std::cout << R"(Usage:
+    MazeGen                      Interactive menu
+    MazeGen batch [options]      Generate many mazes without the menu
+    MazeGen serve [options]      Answer generation requests (JSON lines) until stopped
+    MazeGen client [options]     Send requests to a running server and measure it
+    MazeGen export IN OUT [--scale N] [--format F]
+                                 Convert the maze file IN to an image or graph, format from OUT's
+                                 extension (.pbm, .png, .edges/.txt, .csr) unless --format is given
+
+Batch options:
+    --count N            number of mazes (default 1)
+    --width W            maze width, odd (default 15)
+    --height H           maze height, odd (default 9)
+    --seed S             base seed, makes the batch reproducible (default random)
+    --algorithm NAME     backtracker, eller, kruskal, prim or wilson (default backtracker)
+    --out DIR            write one file per maze into DIR (default "mazes")
+    --archive FILE       write all mazes into one file instead
+    --rng KIND           mt19937 or xoshiro (default mt19937)
+    --threads T          worker threads, 0 = all cores (default 0)
+    --compress           LZ compress every maze record
+    --legacy             write the old one-byte-per-cell format
+    --solve METHOD       solve every maze (bfs, astar, bidirectional or deadend), fail if one has no path
+
+Serve options:
+    --socket PATH        listen on a Unix domain socket (default: requests on stdin, responses on stdout)
+    --threads T          generation workers, 0 = all cores (default 0)
+    --queue N            requests waiting for a worker before reading pauses (default 256)
+    --max-side N         largest width or height a request may ask for (default 8191)
+
+Client options:
+    --socket PATH        socket of the server (required)
+    --count N            number of requests (default 1000)
+    --inflight K         requests sent ahead of the responses (default 1)
+    --width, --height, --seed, --algorithm, --rng, --compress   as for batch
+)";
+    }
+
+    // MazeGen export IN OUT [--scale N] [--format F] - the maze is mapped, not read, so huge files convert quickly
+    int runExport(int argc, char* argv[]) {
+        if (argc < 4) {
+            std::cerr << "Error: export needs an input and an output file\n\n";
+            printUsage();
+            return 1;
+        }
+        const std::string input = argv[2], output = argv[3];
+
+        ExportFormat format;
+        bool hasFormat = ExportFormatFromFilename(output, format);
+        int scale = 1;
+        for (int i = 4; i < argc; i++) {
+            const std::string option = argv[i];
+            std::string error;
+            if (option == "--scale") {
+                long long value;
+                if (!ReadNumberArg(argc, argv, i, value, error)) {
+                    std::cerr << "Error: " << error << '\n';
+                    return 1;
+                }
+                if (value < 1 || value > kMaxExportScale) {
+                    std::cerr << "Error: --scale must be between 1 and " << kMaxExportScale << '\n';
+                    return 1;
+                }
+                scale = static_cast<int>(value);
+            }
+            else if (option == "--format" && i + 1 < argc) {
+                hasFormat = ParseExportFormat(argv[++i], format);
+                if (!hasFormat) {
+                    std::cerr << "Error: unknown format '" << argv[i] << "' (pbm, png, edges or csr)\n";
+                    return 1;
+                }
+            }
+            else {
+                std::cerr << "Error: unknown export option '" << option << "'\n\n";
+                printUsage();
+                return 1;
+            }
+        }
+        if (!hasFormat) {
+            std::cerr << "Error: cannot tell the format from '" << output << "', use --format\n";
+            return 1;
+        }
+
+        Result<Maze> maze = LoadMaze(input, LoadMode::Map);
+        if (!maze) {
+            std::cerr << "Error: " << input << ": " << MazeErrorMessage(maze.Error()) << '\n';
+            return 1;
+        }
+        const MazeError error = ExportGrid(output, maze.Value().m_Grid, format, scale);
+        if (error != MazeError::None) {
+            std::cerr << "Error: " << output << ": " << MazeErrorMessage(error) << '\n';
+            return 1;
+        }
+        std::cout << "Exported " << maze.Value().m_Width << "x" << maze.Value().m_Height << " maze to " << output
+            << " (" << ExportFormatName(format) << ")\n";
+        return 0;
+    }
+
+    int runCommandLine(int argc, char* argv[]) {
+        std::string command = argv[1];
+
+        if (command == "batch") {
+            BatchOptions options;
+            std::string error;
+            if (!ParseBatchArgs(argc, argv, 2, options, error)) {
+                std::cerr << "Error: " << error << "\n\n";
+                printUsage();
+                return 1;
+            }
+            return RunBatch(options);
+        }
+
+        if (command == "serve" || command == "client") {
+            ServeOptions serveOptions;
+            ClientOptions clientOptions;
+            std::string error;
+            const bool parsed = command == "serve" ? ParseServeArgs(argc, argv, 2, serveOptions, error)
+                                                   : ParseClientArgs(argc, argv, 2, clientOptions, error);
+            if (!parsed) {
+                std::cerr << "Error: " << error << "\n\n";
+                printUsage();
+                return 1;
+            }
+            return command == "serve" ? RunServe(serveOptions) : RunClient(clientOptions);
+        }
+
+        if (command == "export") {
+            return runExport(argc, argv);
+        }
+
+        if (command == "help" || command == "--help" || command == "-h") {
+            printUsage();
+            return 0;
+        }
+
+        std::cerr << "Unknown command '" << command << "'\n\n";
+        printUsage();
+        return 1;
+    }
+
     int run() {
         clearScreen(); // begin with a clear terminal
 
@@ -94,16 +285,19 @@ Choose an option: )";
                     if (!validateInput()) continue;
 
                     generator.SetDimensions(m_Width, m_Height, isGenerating); 
+                    if (isGenerating) generator.Display(); // SetDimensions only generates, the menu shows the new maze
                 }
                 break;
 
             case 2: // Generate Maze
                 std::cout << "generating maze...\n\n";
-                generator.Generate();
+                if (!report(generator.Generate())) break;
+                generator.Display(); // display the generated maze
+                std::cout << "\nSeed: " << generator.GetSeed() << '\n'; // lets the user recreate this maze later
                 break;
 
             case 3: // Display Current Maze
-                generator.Display();
+                report(generator.Display());
                 break;
 
             case 4: // Save Current Maze to File
@@ -112,7 +306,13 @@ Choose an option: )";
                     std::string filename;
                     std::cout << "Enter filename to save: ";
                     std::getline(std::cin, filename);  // allow white spaces
-                    generator.SaveToFile(filename);
+                    int compress = 0;
+                    std::cout << "Compress the maze? (1 = yes, 0 = no): ";
+                    std::cin >> compress;
+                    if (!validateInput()) continue;
+                    if (report(generator.SaveToFile(filename, compress == 1))) {
+                        std::cout << "Maze saved to " << filename << " successfully!\n";
+                    }
                 }
                 break;
 
@@ -122,13 +322,182 @@ Choose an option: )";
                     std::string filename;
                     std::cout << "Enter filename to load: ";
                     std::getline(std::cin, filename); // allow white spaces
-                    if (!generator.LoadFromFile(filename)) {
+                    if (!report(generator.LoadFromFile(filename))) {
                         std::cout << "Failed to load maze. Try again.\n";
+                        break;
                     }
+                    std::cout << "Maze '" << generator.GetMaze().m_Name << "' loaded from " << filename << " successfully!\n";
                 }
                     break;
 
-            case 6:
+            case 6: // Choose the algorithm used by future generations
+                {
+                    std::cout << "Algorithms (current: " << AlgorithmName(generator.GetAlgorithm()) << ")\n";
+                    for (int i = 0; i < static_cast<int>(Algorithm::Count); i++) {
+                        std::cout << "    " << (i + 1) << ". " << AlgorithmName(static_cast<Algorithm>(i)) << '\n';
+                    }
+                    std::cout << "Choose an algorithm: ";
+                    int algorithm;
+                    std::cin >> algorithm;
+                    if (!validateInput()) continue;
+
+                    if (algorithm < 1 || algorithm > static_cast<int>(Algorithm::Count)) {
+                        std::cout << "Invalid algorithm, keeping " << AlgorithmName(generator.GetAlgorithm()) << ".\n";
+                        break;
+                    }
+                    generator.SetAlgorithm(static_cast<Algorithm>(algorithm - 1));
+                    std::cout << "Using " << AlgorithmName(generator.GetAlgorithm()) << " for new mazes.\n";
+                }
+                break;
+
+            case 7: // Generate straight into a file, the maze is never held in memory
+                {
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    std::string filename;
+                    std::cout << "Enter filename to stream to: ";
+                    std::getline(std::cin, filename);
+                    if (report(generator.StreamToFile(filename))) {
+                        std::cout << "Maze streamed to " << filename << " successfully!\n";
+                    }
+                }
+                break;
+
+            case 8: // Number of threads used by Generate
+                {
+                    int threads;
+                    std::cout << "Threads (currently " << generator.GetThreads() << ", 0 = all cores, 1 = single threaded): ";
+                    std::cin >> threads;
+                    if (!validateInput()) continue;
+                    generator.SetThreads(threads);
+                    std::cout << "Generating with " << generator.GetThreads() << " thread(s).\n";
+                }
+                break;
+
+            case 9: // Fix the seed so the same maze can be generated again
+                {
+                    long long seed;
+                    std::cout << "Enter a seed (negative number = new random seed every time): ";
+                    std::cin >> seed;
+                    if (!validateInput()) continue;
+
+                    if (seed < 0) {
+                        generator.ClearSeed();
+                        std::cout << "Every maze will use a new random seed.\n";
+                    }
+                    else {
+                        generator.SetSeed(static_cast<std::uint64_t>(seed));
+                        std::cout << "Every maze will use seed " << seed << ".\n";
+                    }
+                }
+                break;
+
+            case 10: // ASCII or Unicode walls, with or without colour
+                {
+                    RenderOptions options = generator.GetRenderOptions();
+                    int style;
+                    bool color;
+                    std::cout << "Style (1 = ASCII, 2 = Unicode box drawing): ";
+                    std::cin >> style;
+                    if (!validateInput()) continue;
+                    std::cout << "Colour walls (1(Yes) or 0(No))? ";
+                    std::cin >> color;
+                    if (!validateInput()) continue;
+
+                    options.style = (style == 2) ? RenderStyle::Unicode : RenderStyle::Ascii;
+                    options.color = color;
+                    generator.SetRenderOptions(options);
+                    std::cout << "Displaying mazes as " << RenderStyleName(options.style) << (color ? " with colour" : "") << ".\n";
+                }
+                break;
+
+            case 11: // Find the path from the entrance to the exit and show it on the maze
+                {
+                    std::cout << "Solvers\n";
+                    for (int i = 0; i < static_cast<int>(SolveMethod::Count); i++) {
+                        std::cout << "    " << (i + 1) << ". " << SolveMethodName(static_cast<SolveMethod>(i)) << '\n';
+                    }
+                    std::cout << "Choose a solver: ";
+                    int method;
+                    std::cin >> method;
+                    if (!validateInput()) continue;
+
+                    if (method < 1 || method > static_cast<int>(SolveMethod::Count)) {
+                        std::cout << "Invalid solver.\n";
+                        break;
+                    }
+                    const SolveMethod solveMethod = static_cast<SolveMethod>(method - 1);
+                    MazeError error = generator.Solve(solveMethod);
+                    const Solution& solution = generator.GetSolution();
+                    if (error == MazeError::NoSolution) {
+                        std::cout << MazeErrorMessage(error) << " (" << solution.stats.visited << " cells searched)\n";
+                        break;
+                    }
+                    if (!report(error)) break;
+
+                    std::cout << "Solved with " << SolveMethodName(solveMethod) << ": path of " << solution.path.size() << " cells, "
+                        << solution.stats.visited << " cells visited (largest frontier " << solution.stats.maxFrontier << ") in "
+                        << solution.stats.seconds << "s\n";
+                }
+                break;
+
+            case 12: // Timers and counters of the last generation, display, save and load
+                PrintGenerationStats(std::cout, generator.GetStats());
+                break;
+
+            case 13: // Re-randomize one rectangle of cells, the rest of the maze stays as it is
+                {
+                    int x, y, cols, rows;
+                    std::cout << "Cells are numbered from 0, cell (x, y) is drawn at column 2x+1, row 2y+1.\n";
+                    std::cout << "Enter the first cell x and y: ";
+                    std::cin >> x >> y;
+                    if (!validateInput()) continue;
+                    std::cout << "Enter the region width and height in cells: ";
+                    std::cin >> cols >> rows;
+                    if (!validateInput()) continue;
+
+                    if (report(generator.RegenerateRegion({ x, y, cols, rows }))) generator.Display();
+                }
+                break;
+
+            case 14: // An endless maze generated around the view as it moves
+                {
+                    long long seed;
+                    std::cout << "Enter a seed for the infinite maze: ";
+                    std::cin >> seed;
+                    if (!validateInput()) continue;
+                    exploreInfinite(generator, static_cast<std::uint64_t>(seed));
+                    clearScreen();
+                }
+                break;
+
+            case 15: // Write the current maze as an image or a graph for other tools
+                {
+                    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    std::string filename;
+                    std::cout << "Enter filename to export to (.pbm, .png, .edges or .csr): ";
+                    std::getline(std::cin, filename);
+                    ExportFormat format;
+                    if (!ExportFormatFromFilename(filename, format)) {
+                        std::cout << "Unknown file extension, use .pbm, .png, .edges or .csr.\n";
+                        break;
+                    }
+                    int scale = 1;
+                    if (format == ExportFormat::Pbm || format == ExportFormat::Png) {
+                        std::cout << "Pixels per wall or passage (1 to " << kMaxExportScale << "): ";
+                        std::cin >> scale;
+                        if (!validateInput()) continue;
+                        if (scale < 1 || scale > kMaxExportScale) {
+                            std::cout << "The scale must be between 1 and " << kMaxExportScale << ".\n";
+                            break;
+                        }
+                    }
+                    if (report(generator.ExportToFile(filename, format, scale))) {
+                        std::cout << "Maze exported to " << filename << " as " << ExportFormatName(format) << ".\n";
+                    }
+                }
+                break;
+
+            case 16:
                 std::cout << "Exiting program.\n";
                 break;  
 
@@ -138,7 +507,7 @@ Choose an option: )";
 
             }
         
-        }  while (choice != 6); // runs until a 6 is input
+        }  while (choice != 16); // runs until a 16 is input
 
         return 0;
     }
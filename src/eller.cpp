@@ -0,0 +1,172 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: eller.cpp
+ * Description:
+ * Implements Eller's algorithm - builds the maze one row at a time.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "algorithm.h"
+
+namespace MazeGen {
+
+    /* Eller's Algorithm
+
+        Every cell of the current row belongs to a "set" - cells in the same set are already
+        connected through the rows above. For each row:
+            1. Randomly join neighbouring cells that are in different sets (joining cells of the
+               same set would make a loop). On the last row every different pair is joined.
+            2. For every set, open at least one passage down into the next row, so no set is cut off.
+            3. Cells of the next row that did not get a passage from above start in a new set.
+
+        Only the sets of one row are kept, so the memory needed is proportional to the width.
+        Set labels are kept below the column count by renumbering them every row, which lets
+        them index the small per-column arrays directly.
+    */
+
+    static const std::uint32_t kNone = ~std::uint32_t(0);
+
+    void EllerRows::Begin(int cols) {
+        m_Cols = cols > 0 ? cols : 0;
+        m_Sets.resize(m_Cols);
+        m_Parent.resize(m_Cols);
+        m_Count.resize(m_Cols);
+        m_Remap.resize(m_Cols);
+        m_Right.assign(m_Cols, 0);
+        m_Down.assign(m_Cols, 0);
+        m_BitsLeft = 0;
+
+        // First row: every cell is in its own set
+        for (int c = 0; c < m_Cols; c++) m_Sets[c] = c;
+    }
+
+    void EllerRows::Reserve(int cols) {
+        if (cols <= 0) return;
+        const size_t count = static_cast<size_t>(cols);
+        m_Sets.reserve(count);
+        m_Parent.reserve(count);
+        m_Count.reserve(count);
+        m_Remap.reserve(count);
+        m_Right.reserve(count);
+        m_Down.reserve(count);
+    }
+
+    size_t EllerRows::ScratchBytes() const {
+        return (m_Sets.capacity() + m_Parent.capacity() + m_Count.capacity() + m_Remap.capacity()) * sizeof(std::uint32_t)
+            + m_Right.capacity() + m_Down.capacity();
+    }
+
+    void EllerRows::NextRow(Rng& rng, bool lastRow) {
+        const int cols = m_Cols;
+
+        // Union-find over the set labels of the current row (path halving keeps the trees flat)
+        auto find = [this](std::uint32_t i) {
+            while (m_Parent[i] != i) {
+                m_Parent[i] = m_Parent[m_Parent[i]];
+                i = m_Parent[i];
+            }
+            return i;
+        };
+
+        // One random bit at a time, drawn 32 bits per call to the generator
+        auto coin = [&]() {
+            if (m_BitsLeft == 0) {
+                m_Bits = static_cast<std::uint32_t>(rng());
+                m_BitsLeft = 32;
+            }
+            m_BitsLeft--;
+            bool heads = m_Bits & 1u;
+            m_Bits >>= 1;
+            return heads;
+        };
+
+        for (int c = 0; c < cols; c++) {
+            m_Parent[c] = c;
+            m_Right[c] = 0;
+            m_Down[c] = 0;
+        }
+
+        // 1. Join neighbours in different sets
+        for (int c = 0; c + 1 < cols; c++) {
+            std::uint32_t a = find(m_Sets[c]);
+            std::uint32_t b = find(m_Sets[c + 1]);
+            if (a != b && (lastRow || coin())) {
+                m_Right[c] = 1;
+                m_Parent[b] = a;
+            }
+        }
+
+        if (lastRow) return;
+
+        // Resolve every cell to its final set label and count the cells of each set
+        for (int c = 0; c < cols; c++) {
+            m_Count[c] = 0;
+            m_Remap[c] = kNone;
+        }
+        for (int c = 0; c < cols; c++) {
+            m_Sets[c] = find(m_Sets[c]);
+            m_Count[m_Sets[c]]++;
+        }
+
+        // 2. Open passages down. The last cell of a set is forced down if none of the others went
+        std::uint32_t nextLabel = 0;
+        for (int c = 0; c < cols; c++) {
+            std::uint32_t set = m_Sets[c];
+            bool lastOfSet = (--m_Count[set] == 0);
+
+            if (coin() || (lastOfSet && m_Remap[set] == kNone)) {
+                m_Down[c] = 1;
+                if (m_Remap[set] == kNone) m_Remap[set] = nextLabel++; // renumber sets that continue down
+                m_Sets[c] = m_Remap[set];
+            }
+            else {
+                m_Sets[c] = kNone;
+            }
+        }
+
+        // 3. Cells with no passage from above start a new set
+        for (int c = 0; c < cols; c++) {
+            if (m_Sets[c] == kNone) m_Sets[c] = nextLabel++;
+        }
+    }
+
+    void EllerAlgorithm::Reserve(const CellRegion& region) {
+        m_Rows.Reserve(region.cols); // one row of cells is all Eller's algorithm keeps
+    }
+
+    void EllerAlgorithm::Carve(Grid& grid, const CellRegion& region, Rng& rng) {
+        if (region.cols <= 0 || region.rows <= 0) return;
+
+        m_Rows.Begin(region.cols);
+
+        for (int r = 0; r < region.rows; r++) {
+            m_Rows.NextRow(rng, r == region.rows - 1);
+
+            const int gy = region.GridY(r);
+            const std::vector<std::uint8_t>& right = m_Rows.Right();
+            const std::vector<std::uint8_t>& down = m_Rows.Down();
+
+            // Copy the decisions of this row into the grid
+            for (int c = 0; c < region.cols; c++) {
+                const int gx = region.GridX(c);
+                grid.SetPassage(gx, gy); // open the cell itself
+                if (right[c]) grid.SetPassage(gx + 1, gy);
+                if (down[c]) grid.SetPassage(gx, gy + 1);
+                MAZEGEN_STAT(m_Counters.wallsRemoved += static_cast<std::uint64_t>(right[c] != 0) + (down[c] != 0));
+            }
+        }
+
+        MAZEGEN_STAT(m_Counters.cellsVisited += region.CellCount(), m_Counters.steps += region.CellCount(),
+                     StatMax(m_Counters.scratchBytes, m_Rows.ScratchBytes()));
+    }
+
+}
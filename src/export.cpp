@@ -0,0 +1,495 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: export.cpp
+ * Description:
+ * Implements the streaming PBM, PNG, edge list and CSR exporters.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "export.h"
+#include "checksum.h" // Used for the CRC-32 of every PNG chunk
+#include "deflate.h"  // Used for the PNG image data
+#include "kernels.h"  // Used for NthOpenCell() to find the entrance and exit
+#include "maze_io.h"  // Used for TempFileName() and ReplaceFile()
+#include "renderer.h" // Used for OutputBuffer
+#include <algorithm>
+#include <cctype>  // Used for std::tolower() on file extensions
+#include <cstring>
+#include <vector>
+
+namespace MazeGen {
+
+    static const size_t kIdatChunkSize = 64 * 1024; // compressed bytes collected before they go out as one IDAT chunk
+    static const std::uint64_t kMaxImageSide = 0x7FFFFFFF; // PNG stores sizes as 31 bit numbers
+    static const std::uint64_t kNoNode = ~std::uint64_t(0);
+
+    const char* ExportFormatName(ExportFormat format) {
+        switch (format) {
+        case ExportFormat::Pbm: return "pbm";
+        case ExportFormat::Png: return "png";
+        case ExportFormat::EdgeList: return "edges";
+        case ExportFormat::Csr: return "csr";
+        default: return "unknown";
+        }
+    }
+
+    bool ParseExportFormat(const std::string& name, ExportFormat& out) {
+        for (int i = 0; i < static_cast<int>(ExportFormat::Count); i++) {
+            if (name == ExportFormatName(static_cast<ExportFormat>(i))) {
+                out = static_cast<ExportFormat>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ExportFormatFromFilename(const std::string& filename, ExportFormat& out) {
+        const size_t dot = filename.find_last_of('.');
+        if (dot == std::string::npos) return false;
+        std::string extension = filename.substr(dot + 1);
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (extension == "txt") extension = "edges";
+        return ParseExportFormat(extension, out);
+    }
+
+    // ***********************************
+    // IMAGES
+    // ***********************************
+
+    /* Packing Image Rows
+        Grid words keep cell x in bit x % 64, lowest bit first. PBM and PNG both want the leftmost
+        pixel in the highest bit of each byte. So every byte of a grid row is simply bit reversed
+        with a table - 8 pixels per lookup.
+    */
+    struct ReverseTable {
+        std::uint8_t bytes[256];
+
+        ReverseTable() {
+            for (int value = 0; value < 256; value++) {
+                int reversed = 0;
+                for (int bit = 0; bit < 8; bit++) {
+                    if (value & (1 << bit)) reversed |= 0x80 >> bit;
+                }
+                bytes[value] = static_cast<std::uint8_t>(reversed);
+            }
+        }
+    };
+
+    static const ReverseTable s_ReverseTable;
+
+    // Packs row y into out as 1 bit per pixel, scale pixels per cell. Walls are 1 unless invert is set.
+    static void packRow(const Grid& grid, int y, int scale, bool invert, std::uint8_t* out, size_t bytes) {
+        const std::uint8_t flip = invert ? 0xFF : 0x00;
+
+        if (scale == 1) {
+            const Grid::Word* row = grid.Row(y);
+            for (size_t i = 0; i < bytes; i++) {
+                const std::uint8_t cells = static_cast<std::uint8_t>(row[i / 8] >> (8 * (i % 8)));
+                out[i] = s_ReverseTable.bytes[cells] ^ flip;
+            }
+        }
+        else {
+            std::memset(out, flip, bytes);
+            for (int x = 0; x < grid.Width(); x++) {
+                if (!grid.IsWall(x, y)) continue;
+                const size_t first = static_cast<size_t>(x) * scale;
+                for (size_t pixel = first; pixel < first + static_cast<size_t>(scale); pixel++) {
+                    out[pixel / 8] ^= static_cast<std::uint8_t>(0x80 >> (pixel % 8));
+                }
+            }
+        }
+
+        // Bits past the last pixel are always 0
+        const size_t pixels = static_cast<size_t>(grid.Width()) * scale;
+        if (pixels % 8 != 0) out[bytes - 1] &= static_cast<std::uint8_t>(0xFF << (8 - pixels % 8));
+    }
+
+    static MazeError exportPbm(OutputBuffer& out, const Grid& grid, int scale) {
+        const std::uint64_t width = static_cast<std::uint64_t>(grid.Width()) * scale;
+        const std::uint64_t height = static_cast<std::uint64_t>(grid.Height()) * scale;
+        if (width > kMaxImageSide || height > kMaxImageSide) return MazeError::TooLarge; // same limit as PNG, it bounds the row buffer
+        out.Append("P4\n" + std::to_string(width) + " " + std::to_string(height) + "\n");
+
+        const size_t bytes = static_cast<size_t>((width + 7) / 8);
+        std::vector<std::uint8_t> row(bytes);
+        for (int y = 0; y < grid.Height(); y++) {
+            packRow(grid, y, scale, false, row.data(), bytes);
+            for (int copy = 0; copy < scale; copy++) out.Append(reinterpret_cast<const char*>(row.data()), bytes);
+        }
+        return MazeError::None;
+    }
+
+    static void putBigEndian32(OutputBuffer& out, std::uint32_t value) {
+        char* bytes = out.Reserve(4);
+        for (int i = 0; i < 4; i++) bytes[i] = static_cast<char>(value >> (24 - 8 * i));
+        out.Commit(4);
+    }
+
+    // Length, type, data and the CRC-32 of type and data
+    static void writeChunk(OutputBuffer& out, const char* type, const std::uint8_t* data, size_t size) {
+        putBigEndian32(out, static_cast<std::uint32_t>(size));
+        out.Append(type, 4);
+        out.Append(reinterpret_cast<const char*>(data), size);
+        putBigEndian32(out, Crc32(data, size, Crc32(type, 4)));
+    }
+
+    static MazeError exportPng(OutputBuffer& out, const Grid& grid, int scale) {
+        const std::uint64_t width = static_cast<std::uint64_t>(grid.Width()) * scale;
+        const std::uint64_t height = static_cast<std::uint64_t>(grid.Height()) * scale;
+        if (width > kMaxImageSide || height > kMaxImageSide) return MazeError::TooLarge;
+
+        static const char kSignature[8] = { '\x89', 'P', 'N', 'G', '\r', '\n', '\x1A', '\n' };
+        out.Append(kSignature, sizeof(kSignature));
+
+        // Width, height, bit depth 1, greyscale, deflate, no filtering extensions, not interlaced
+        std::uint8_t header[13] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0 };
+        for (int i = 0; i < 4; i++) {
+            header[i] = static_cast<std::uint8_t>(width >> (24 - 8 * i));
+            header[4 + i] = static_cast<std::uint8_t>(height >> (24 - 8 * i));
+        }
+        writeChunk(out, "IHDR", header, sizeof(header));
+
+        // Every scanline starts with its filter type - 0, the pixels as they are. Greyscale 1 = white, so walls are 0.
+        const size_t bytes = static_cast<size_t>((width + 7) / 8);
+        std::vector<std::uint8_t> scanline(bytes + 1, 0);
+        ZlibWriter zlib;
+        auto sendImageData = [&](size_t atLeast) {
+            if (zlib.Output().size() < atLeast) return;
+            writeChunk(out, "IDAT", zlib.Output().data(), zlib.Output().size());
+            zlib.Output().clear();
+        };
+
+        for (int y = 0; y < grid.Height(); y++) {
+            packRow(grid, y, scale, true, scanline.data() + 1, bytes);
+            for (int copy = 0; copy < scale; copy++) {
+                zlib.Write(scanline.data(), scanline.size());
+                sendImageData(kIdatChunkSize);
+            }
+        }
+        zlib.Finish();
+        sendImageData(1);
+
+        writeChunk(out, "IEND", nullptr, 0);
+        return MazeError::None;
+    }
+
+    // ***********************************
+    // GRAPHS
+    // ***********************************
+
+    using Word = Grid::Word;
+
+    static constexpr Word kOddBits = 0xAAAAAAAAAAAAAAAAull; // bits 1, 3, 5, ... - cells sit on odd x
+
+    static inline int popcount64(Word w) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(w);
+#else
+        int count = 0;
+        for (; w; w &= w - 1) count++;
+        return count;
+#endif
+    }
+
+    static inline int lowestBit(Word w) { // w must not be 0
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(w);
+#else
+        int bit = 0;
+        while (!(w & 1u)) { w >>= 1; bit++; }
+        return bit;
+#endif
+    }
+
+    /* Edge Rows
+        The graph is read one row of cells at a time, 64 grid positions per word like the kernels in
+        kernels.cpp. For the cell row at grid row y, with open = ~walls:
+            right = open(y) & open(y) >> 1 & open(y) >> 2     the cell, the wall and the next cell
+            down  = open(y) & open(y + 1) & open(y + 2)       the same going down
+        both kept on the odd bits (the cells). The cell's "up" edges are the previous row's down
+        edges, its "left" edges the right edges shifted two positions along. Only these few words per
+        row are ever held, and the exporters visit set bits only - not every cell and wall.
+    */
+    class EdgeRows {
+    public:
+        explicit EdgeRows(const Grid& grid)
+            : m_Grid(grid), m_Cols(std::max(grid.Width() - 1, 0) / 2), m_Rows(std::max(grid.Height() - 1, 0) / 2),
+              m_Right(grid.WordsPerRow(), 0), m_Down(grid.WordsPerRow(), 0), m_Up(grid.WordsPerRow(), 0) {
+            if (m_Cols == 0 || m_Rows == 0) m_Cols = m_Rows = 0; // no cells - an empty graph
+        }
+
+        int Cols() const { return m_Cols; }
+        int Rows() const { return m_Rows; }
+        size_t Words() const { return m_Right.size(); }
+
+        std::uint64_t NodeCount() const { return static_cast<std::uint64_t>(m_Cols) * m_Rows; }
+
+        // Node of the cell at grid position x on cell row cy
+        std::uint64_t Node(int cy, size_t x) const { return static_cast<std::uint64_t>(cy) * m_Cols + (x - 1) / 2; }
+
+        // Works out the edges of cell row cy - rows must be loaded in order, starting at 0
+        void Load(int cy) {
+            if (cy == 0) std::fill(m_Down.begin(), m_Down.end(), 0);
+            m_Up.swap(m_Down);
+
+            const int y = 2 * cy + 1;
+            const Word* row = m_Grid.Row(y);
+            const bool hasDown = cy + 1 < m_Rows;
+            const Word* wallRow = hasDown ? m_Grid.Row(y + 1) : nullptr;
+            const Word* nextRow = hasDown ? m_Grid.Row(y + 2) : nullptr;
+            const size_t lastCell = static_cast<size_t>(2 * m_Cols - 1); // x of the last cell in the row
+
+            for (size_t i = 0; i < Words(); i++) {
+                const Word open = ~row[i];
+                const Word nextOpen = i + 1 < Words() ? ~row[i + 1] : 0;
+                const Word cells = open & kOddBits & upTo(i, lastCell);
+                m_Right[i] = cells & ((open >> 1) | (nextOpen << 63)) & ((open >> 2) | (nextOpen << 62)) & upTo(i, lastCell - 2);
+                m_Down[i] = hasDown ? cells & ~wallRow[i] & ~nextRow[i] : 0;
+            }
+        }
+
+        Word Right(size_t i) const { return m_Right[i]; }
+        Word Down(size_t i) const { return m_Down[i]; }
+        Word Up(size_t i) const { return m_Up[i]; }
+        Word Left(size_t i) const { return (m_Right[i] << 2) | (i > 0 ? m_Right[i - 1] >> 62 : 0); }
+
+        // Edges in the whole maze - the count goes into the headers before any edge is written
+        std::uint64_t EdgeCount() {
+            std::uint64_t edges = 0;
+            for (int cy = 0; cy < m_Rows; cy++) {
+                Load(cy);
+                for (size_t i = 0; i < Words(); i++) edges += static_cast<std::uint64_t>(popcount64(m_Right[i]) + popcount64(m_Down[i]));
+            }
+            return edges;
+        }
+
+        // The cell next to the first opening in the top (or bottom) border row
+        std::uint64_t BorderNode(bool bottom) const {
+            if (m_Cols == 0 || m_Rows == 0) return kNoNode;
+            const int x = NthOpenCell(m_Grid, bottom ? m_Grid.Height() - 1 : 0, 0);
+            if (x < 0 || (x - 1) / 2 >= m_Cols) return kNoNode;
+            return Node(bottom ? m_Rows - 1 : 0, static_cast<size_t>(x));
+        }
+
+    private:
+        // Bits of word i at grid positions up to and including x
+        static Word upTo(size_t i, size_t x) {
+            const size_t first = i * Grid::kWordBits;
+            if (x + 1 <= first || x == static_cast<size_t>(-1)) return 0;
+            if (x - first >= Grid::kWordBits - 1) return ~Word(0);
+            return (Word(2) << (x - first)) - 1;
+        }
+
+        const Grid& m_Grid;
+        int m_Cols, m_Rows;
+        std::vector<Word> m_Right, m_Down, m_Up;
+    };
+
+    /* Decimal Counters
+        The edge list is nearly all numbers - two per edge, hundreds of millions for a big maze. But
+        the nodes come in increasing order, and every line is "node node+1" or "node node+cols". So
+        instead of converting each number, three decimal strings are kept (node, node + 1 and
+        node + cols) and moved forward together: adding a small step to a decimal string only touches
+        its last digit or two.
+    */
+    class DecimalCounter {
+    public:
+        explicit DecimalCounter(std::uint64_t value) {
+            m_Start = kDigits;
+            do {
+                m_Text[--m_Start] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while (value > 0);
+        }
+
+        void Add(std::uint64_t step) {
+            for (int i = kDigits - 1; step > 0; i--) {
+                if (i < m_Start) {
+                    m_Text[i] = '0';
+                    m_Start = i;
+                }
+                step += static_cast<std::uint64_t>(m_Text[i] - '0');
+                m_Text[i] = static_cast<char>('0' + step % 10);
+                step /= 10;
+            }
+        }
+
+        // Copies the digits and then after to text, returns the bytes written
+        size_t Put(char* text, char after) const {
+            const size_t length = static_cast<size_t>(kDigits - m_Start);
+            std::memcpy(text, m_Text + m_Start, kDigits); // a fixed size copy is a couple of moves, the bytes past the digits are overwritten later
+            text[length] = after;
+            return length + 1;
+        }
+
+        static const int kDigits = 20; // enough for any 64 bit number
+
+    private:
+        char m_Text[2 * kDigits] = {}; // digits at the end of the first half, the second half is room for Put's copy
+        int m_Start;                   // first digit in m_Text
+    };
+
+    static MazeError exportEdgeList(OutputBuffer& out, const Grid& grid) {
+        EdgeRows edges(grid);
+        const std::uint64_t entrance = edges.BorderNode(false), exit = edges.BorderNode(true);
+
+        out.Append("# mazegen edge list\n# cols " + std::to_string(edges.Cols()) + " rows " + std::to_string(edges.Rows())
+            + " nodes " + std::to_string(edges.NodeCount()) + " edges " + std::to_string(edges.EdgeCount())
+            + " entrance " + (entrance == kNoNode ? std::string("none") : std::to_string(entrance))
+            + " exit " + (exit == kNoNode ? std::string("none") : std::to_string(exit)) + "\n");
+
+        DecimalCounter node(0), nextNode(1), belowNode(static_cast<std::uint64_t>(edges.Cols()));
+        std::uint64_t at = 0; // the node the counters are on
+        for (int cy = 0; cy < edges.Rows(); cy++) {
+            edges.Load(cy);
+            for (size_t i = 0; i < edges.Words(); i++) {
+                const Word right = edges.Right(i), down = edges.Down(i);
+                for (Word bits = right | down; bits; bits &= bits - 1) {
+                    const int bit = lowestBit(bits);
+                    const std::uint64_t step = edges.Node(cy, i * Grid::kWordBits + bit) - at;
+                    node.Add(step);
+                    nextNode.Add(step);
+                    belowNode.Add(step);
+                    at += step;
+
+                    char* text = out.Reserve(5 * DecimalCounter::kDigits);
+                    size_t used = 0;
+                    if ((right >> bit) & 1u) {
+                        used += node.Put(text + used, ' ');
+                        used += nextNode.Put(text + used, '\n');
+                    }
+                    if ((down >> bit) & 1u) {
+                        used += node.Put(text + used, ' ');
+                        used += belowNode.Put(text + used, '\n');
+                    }
+                    out.Commit(used);
+                }
+            }
+        }
+        return MazeError::None;
+    }
+
+    static void putLittleEndian(OutputBuffer& out, std::uint64_t value, int bytes) {
+        char* data = out.Reserve(static_cast<size_t>(bytes));
+        for (int i = 0; i < bytes; i++) data[i] = static_cast<char>(value >> (8 * i));
+        out.Commit(static_cast<size_t>(bytes));
+    }
+
+    static void storeLittleEndian32(char* data, std::uint64_t value) {
+        for (int i = 0; i < 4; i++) data[i] = static_cast<char>(value >> (8 * i));
+    }
+
+    static MazeError exportCsr(OutputBuffer& out, const Grid& grid) {
+        EdgeRows edges(grid);
+        if (edges.NodeCount() >= 0x80000000ull) return MazeError::TooLarge; // node numbers and offsets are 32 bits
+
+        // Pass 1: how many neighbour entries there will be, for the header
+        const std::uint64_t entries = edges.EdgeCount() * 2;
+
+        out.Append("MCSR", 4);
+        putLittleEndian(out, 1, 4);
+        putLittleEndian(out, static_cast<std::uint64_t>(edges.Cols()), 4);
+        putLittleEndian(out, static_cast<std::uint64_t>(edges.Rows()), 4);
+        putLittleEndian(out, edges.NodeCount(), 8);
+        putLittleEndian(out, entries, 8);
+        putLittleEndian(out, edges.BorderNode(false), 8);
+        putLittleEndian(out, edges.BorderNode(true), 8);
+
+        // Pass 2: offsets - a running sum of the degrees, one entry for every cell
+        std::uint64_t offset = 0;
+        putLittleEndian(out, 0, 4);
+        const size_t lastCell = static_cast<size_t>(2 * edges.Cols() - 1);
+        for (int cy = 0; cy < edges.Rows(); cy++) {
+            edges.Load(cy);
+            for (size_t i = 0; i < edges.Words(); i++) {
+                const Word up = edges.Up(i), left = edges.Left(i), right = edges.Right(i), down = edges.Down(i);
+                const size_t first = i * Grid::kWordBits + 1;
+                const size_t last = std::min(lastCell, first + Grid::kWordBits - 2);
+                if (first > last) break;
+
+                char* data = out.Reserve(4 * Grid::kWordBits / 2);
+                size_t used = 0;
+                for (size_t bit = 1; bit <= last - first + 1; bit += 2) {
+                    offset += ((up >> bit) & 1u) + ((left >> bit) & 1u) + ((right >> bit) & 1u) + ((down >> bit) & 1u);
+                    storeLittleEndian32(data + used, offset);
+                    used += 4;
+                }
+                out.Commit(used);
+            }
+        }
+
+        // Pass 3: neighbours in ascending order - up, left, right, down. Each is stored and kept only if its edge exists.
+        for (int cy = 0; cy < edges.Rows(); cy++) {
+            edges.Load(cy);
+            for (size_t i = 0; i < edges.Words(); i++) {
+                const Word up = edges.Up(i), left = edges.Left(i), right = edges.Right(i), down = edges.Down(i);
+                for (Word bits = up | left | right | down; bits; bits &= bits - 1) {
+                    const int bit = lowestBit(bits);
+                    const std::uint64_t node = edges.Node(cy, i * Grid::kWordBits + bit);
+                    char* data = out.Reserve(16);
+                    size_t used = 0;
+                    storeLittleEndian32(data + used, node - edges.Cols());
+                    used += 4 * ((up >> bit) & 1u);
+                    storeLittleEndian32(data + used, node - 1);
+                    used += 4 * ((left >> bit) & 1u);
+                    storeLittleEndian32(data + used, node + 1);
+                    used += 4 * ((right >> bit) & 1u);
+                    storeLittleEndian32(data + used, node + edges.Cols());
+                    used += 4 * ((down >> bit) & 1u);
+                    out.Commit(used);
+                }
+            }
+        }
+        return MazeError::None;
+    }
+
+    // ***********************************
+    // EXPORT
+    // ***********************************
+
+    MazeError ExportGrid(std::FILE* file, const Grid& grid, ExportFormat format, int scale) {
+        if (grid.Empty()) return MazeError::NoMaze;
+        if (!file) return MazeError::OpenFailed;
+        if (scale > kMaxExportScale) return MazeError::TooLarge;
+        scale = std::max(scale, 1);
+
+        OutputBuffer out(file);
+        MazeError error;
+        switch (format) {
+        case ExportFormat::Pbm: error = exportPbm(out, grid, scale); break;
+        case ExportFormat::Png: error = exportPng(out, grid, scale); break;
+        case ExportFormat::EdgeList: error = exportEdgeList(out, grid); break;
+        case ExportFormat::Csr: error = exportCsr(out, grid); break;
+        default: return MazeError::InvalidFile;
+        }
+        if (error != MazeError::None) return error;
+        return out.Flush() ? MazeError::None : MazeError::WriteFailed;
+    }
+
+    MazeError ExportGrid(const std::string& filename, const Grid& grid, ExportFormat format, int scale) {
+        if (grid.Empty()) return MazeError::NoMaze;
+        if (scale > kMaxExportScale) return MazeError::TooLarge; // before the file is created
+
+        const std::string temp = TempFileName(filename);
+        std::FILE* file = std::fopen(temp.c_str(), "wb");
+        if (!file) return MazeError::OpenFailed;
+
+        MazeError error = ExportGrid(file, grid, format, scale);
+        if (std::fclose(file) != 0 && error == MazeError::None) error = MazeError::WriteFailed;
+        if (error != MazeError::None) {
+            std::remove(temp.c_str());
+            return error;
+        }
+        return ReplaceFile(temp, filename) ? MazeError::None : MazeError::WriteFailed;
+    }
+
+}
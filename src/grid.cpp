@@ -0,0 +1,165 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: grid.cpp
+ * Description:
+ * Implements the bit-packed Grid storage.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "grid.h"
+#include <algorithm> // Used for std::min()
+#include <cstring>  // Used for std::memcpy()
+#include <utility>  // Used for std::move()
+
+namespace MazeGen {
+
+    Grid::Grid(const Grid& other)
+        : m_Width(other.m_Width), m_Height(other.m_Height), m_WordsPerRow(other.m_WordsPerRow),
+          m_Words(other.m_Data, other.m_Data + other.WordCount()), m_Data(m_Words.data()) {}
+
+    Grid::Grid(Grid&& other) noexcept : Grid() {
+        *this = std::move(other);
+    }
+
+    Grid& Grid::operator=(const Grid& other) {
+        if (this != &other) {
+            m_Words.assign(other.m_Data, other.m_Data + other.WordCount());
+            m_Data = m_Words.data();
+            m_Storage.reset();
+            m_Width = other.m_Width;
+            m_Height = other.m_Height;
+            m_WordsPerRow = other.m_WordsPerRow;
+        }
+        return *this;
+    }
+
+    Grid& Grid::operator=(Grid&& other) noexcept {
+        if (this != &other) {
+            m_Words = std::move(other.m_Words); // moving a vector keeps its buffer, so m_Data stays valid
+            m_Storage = std::move(other.m_Storage);
+            m_Data = other.m_Data;
+            m_Width = other.m_Width;
+            m_Height = other.m_Height;
+            m_WordsPerRow = other.m_WordsPerRow;
+
+            other.m_Words.clear();
+            other.m_Storage.reset();
+            other.m_Data = nullptr;
+            other.m_Width = other.m_Height = 0;
+            other.m_WordsPerRow = 0;
+        }
+        return *this;
+    }
+
+    void Grid::Assign(int w, int h, bool walls) {
+        if (w <= 0 || h <= 0) {
+            Clear();
+            return;
+        }
+
+        m_Width = w;
+        m_Height = h;
+        m_WordsPerRow = (static_cast<size_t>(w) + kWordBits - 1) / kWordBits; // round up to whole words
+
+        // A full word of walls, and the last word of the row where only the used bits are set (padding stays 0)
+        const Word full = walls ? ~Word(0) : Word(0);
+        const int tailBits = w % kWordBits;
+        const Word tail = (walls && tailBits != 0) ? (Word(1) << tailBits) - 1 : full;
+
+        // assign() reuses the existing capacity, so regenerating at the same size does not allocate
+        m_Words.assign(m_WordsPerRow * static_cast<size_t>(h), full);
+        m_Data = m_Words.data();
+        m_Storage.reset(); // back to owned storage if the grid was adopted
+        for (int y = 0; y < h; y++) {
+            Row(y)[m_WordsPerRow - 1] = tail;
+        }
+    }
+
+    void Grid::Reserve(int w, int h) {
+        if (w <= 0 || h <= 0) return;
+        const size_t wordsPerRow = (static_cast<size_t>(w) + kWordBits - 1) / kWordBits;
+        m_Words.reserve(wordsPerRow * static_cast<size_t>(h)); // never shrinks - only grows when the size grows
+        if (!m_Storage) m_Data = m_Words.data(); // reserve may have moved the owned words
+    }
+
+    void Grid::Clear() {
+        m_Width = m_Height = 0;
+        m_WordsPerRow = 0;
+        std::vector<Word>().swap(m_Words); // swap with an empty vector to actually give the memory back
+        m_Data = nullptr;
+        m_Storage.reset();
+    }
+
+    void Grid::Adopt(int w, int h, Word* words, std::shared_ptr<void> storage) {
+        std::vector<Word>().swap(m_Words); // the owned buffer is not needed while the words live elsewhere
+        m_Width = w;
+        m_Height = h;
+        m_WordsPerRow = (static_cast<size_t>(w) + kWordBits - 1) / kWordBits;
+        m_Data = words;
+        m_Storage = std::move(storage);
+    }
+
+    /* Byte Lookup Table
+
+        Every packed byte holds 8 cells, so there are only 256 possible patterns. The table stores the
+        8 printable characters of each pattern, and a row is expanded by copying 8 characters per byte
+        instead of testing every bit on its own.
+    */
+    struct CharTable {
+        char chars[256][8];
+
+        CharTable() {
+            for (int pattern = 0; pattern < 256; pattern++) {
+                for (int bit = 0; bit < 8; bit++) {
+                    chars[pattern][bit] = ((pattern >> bit) & 1) ? Grid::kWall : Grid::kPassage;
+                }
+            }
+        }
+    };
+
+    static const CharTable s_CharTable;
+
+    void Grid::RowToChars(int y, int x, int count, char* out) const {
+        const Word* row = Row(y);
+        const int end = x + count;
+
+        // Single cells until x sits on a byte boundary
+        for (; x < end && x % 8 != 0; x++) {
+            *out++ = ((row[x / kWordBits] >> (x % kWordBits)) & 1u) ? kWall : kPassage;
+        }
+
+        // Whole bytes through the lookup table
+        for (; x + 8 <= end; x += 8) {
+            unsigned pattern = static_cast<unsigned>(row[x / kWordBits] >> (x % kWordBits)) & 0xFFu;
+            std::memcpy(out, s_CharTable.chars[pattern], 8);
+            out += 8;
+        }
+
+        // Whatever is left at the end of the row
+        for (; x < end; x++) {
+            *out++ = ((row[x / kWordBits] >> (x % kWordBits)) & 1u) ? kWall : kPassage;
+        }
+    }
+
+    void Grid::RowFromChars(int y, const char* in) {
+        // One word at a time without branches - the compiler can turn the inner loop into vector compares
+        Word* row = Row(y);
+        for (size_t i = 0; i < m_WordsPerRow; i++) {
+            const int begin = static_cast<int>(i) * kWordBits;
+            const int count = std::min(kWordBits, m_Width - begin);
+            Word word = 0;
+            for (int b = 0; b < count; b++) word |= Word(in[begin + b] != kPassage) << b;
+            row[i] = word;
+        }
+    }
+
+}
@@ -0,0 +1,448 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: kernels.cpp
+ * Description:
+ * Implements the bit-parallel analysis kernels (scalar, popcnt and AVX2 builds)
+ * and picks the best one for the CPU at run time.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "kernels.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// The vector builds need GCC/Clang function target attributes and an x86 CPU
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MAZEGEN_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MAZEGEN_INLINE inline __attribute__((always_inline)) // so the body is compiled again inside every target build
+#else
+#define MAZEGEN_INLINE inline
+#endif
+
+namespace MazeGen {
+
+    using Word = Grid::Word;
+
+    static constexpr Word kOddBits = 0xAAAAAAAAAAAAAAAAull; // bits 1, 3, 5, ... - cells sit on odd x
+
+    // ***********************************
+    // WORD HELPERS
+    // ***********************************
+
+    static MAZEGEN_INLINE int popcount64(Word w) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(w); // a single instruction in the popcnt/avx2 builds
+#else
+        // SWAR popcount: add neighbouring bits, then pairs, then nibbles, then sum the bytes with a multiply
+        w = w - ((w >> 1) & 0x5555555555555555ull);
+        w = (w & 0x3333333333333333ull) + ((w >> 2) & 0x3333333333333333ull);
+        w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return static_cast<int>((w * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    static MAZEGEN_INLINE int lowestBit(Word w) { // w must not be 0
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(w);
+#else
+        int bit = 0;
+        while (!(w & 1u)) { w >>= 1; bit++; }
+        return bit;
+#endif
+    }
+
+    // Mask of the bits of word i that are real cells (the padding of the last word is cut off)
+    static MAZEGEN_INLINE Word validBits(const Grid& grid, size_t i) {
+        const int tail = grid.Width() % Grid::kWordBits;
+        return (i + 1 == grid.WordsPerRow() && tail != 0) ? (Word(1) << tail) - 1 : ~Word(0);
+    }
+
+    // validBits without the last column - on an even width it is border, not a cell with a right neighbour
+    static MAZEGEN_INLINE Word cellBits(const Grid& grid, size_t i) {
+        const size_t last = static_cast<size_t>(grid.Width() - 1);
+        Word bits = validBits(grid, i);
+        if (last / Grid::kWordBits == i) bits &= ~(Word(1) << (last % Grid::kWordBits));
+        return bits;
+    }
+
+    /* Exactly Three Walls
+        For four masks a, b, c, d the bits set in exactly three of them are those where either
+        a and b are both set and exactly one of c, d is - or the other way round.
+    */
+    static MAZEGEN_INLINE Word exactlyThree(Word a, Word b, Word c, Word d) {
+        return ((a & b) & (c ^ d)) | ((c & d) & (a ^ b));
+    }
+
+    // Dead ends among the 64 positions of cur. prev/next are the words either side of it in the row
+    // (0 past the ends), up/down the same word in the rows above and below.
+    static MAZEGEN_INLINE Word deadEndWord(Word up, Word down, Word prev, Word cur, Word next, Word cells) {
+        const Word open = ~cur & kOddBits & cells;
+        const Word left = (cur << 1) | (prev >> 63);  // bit x = wall at x - 1
+        const Word right = (cur >> 1) | (next << 63); // bit x = wall at x + 1
+        return open & exactlyThree(up, down, left, right);
+    }
+
+    // ***********************************
+    // SCALAR KERNEL BODIES
+    // ***********************************
+
+    static MAZEGEN_INLINE size_t countWallsBody(const Grid& grid) {
+        const Word* words = grid.Data();
+        const size_t count = grid.WordCount();
+        size_t walls = 0;
+        for (size_t i = 0; i < count; i++) walls += static_cast<size_t>(popcount64(words[i])); // padding bits are 0
+        return walls;
+    }
+
+    // Calls visit(y, i, mask) with the dead-end mask of every word on every row of cells
+    template <typename Visit>
+    static MAZEGEN_INLINE void deadEndRows(const Grid& grid, Visit&& visit) {
+        const size_t words = grid.WordsPerRow();
+        for (int y = 1; y + 1 < grid.Height(); y += 2) {
+            const Word* up = grid.Row(y - 1);
+            const Word* row = grid.Row(y);
+            const Word* down = grid.Row(y + 1);
+            for (size_t i = 0; i < words; i++) {
+                const Word prev = i > 0 ? row[i - 1] : 0;
+                const Word next = i + 1 < words ? row[i + 1] : 0;
+                visit(y, i, deadEndWord(up[i], down[i], prev, row[i], next, cellBits(grid, i)));
+            }
+        }
+    }
+
+    static MAZEGEN_INLINE size_t countDeadEndsBody(const Grid& grid) {
+        size_t count = 0;
+        deadEndRows(grid, [&](int, size_t, Word mask) { count += static_cast<size_t>(popcount64(mask)); });
+        return count;
+    }
+
+    static MAZEGEN_INLINE void deadEndMaskBody(const Grid& grid, Grid& out) {
+        out.Assign(grid.Width(), grid.Height(), false);
+        deadEndRows(grid, [&](int y, size_t i, Word mask) { out.Row(y)[i] = mask; });
+    }
+
+    static MAZEGEN_INLINE size_t countOpenCellsBody(const Grid& grid, int y) {
+        const Word* row = grid.Row(y);
+        size_t count = 0;
+        for (size_t i = 0; i < grid.WordsPerRow(); i++) count += static_cast<size_t>(popcount64(~row[i] & kOddBits & validBits(grid, i)));
+        return count;
+    }
+
+    static MAZEGEN_INLINE int nthOpenCellBody(const Grid& grid, int y, size_t n) {
+        const Word* row = grid.Row(y);
+        for (size_t i = 0; i < grid.WordsPerRow(); i++) {
+            Word open = ~row[i] & kOddBits & validBits(grid, i);
+            const size_t count = static_cast<size_t>(popcount64(open));
+            if (n >= count) {
+                n -= count; // not in this word - skip all of it at once
+                continue;
+            }
+            for (; n > 0; n--) open &= open - 1; // clear the lowest set bit n times
+            return static_cast<int>(i * Grid::kWordBits) + lowestBit(open);
+        }
+        return -1;
+    }
+
+    // ***********************************
+    // BUILDS
+    // ***********************************
+
+    struct KernelTable {
+        size_t (*countWalls)(const Grid&);
+        size_t (*countDeadEnds)(const Grid&);
+        void (*deadEndMask)(const Grid&, Grid&);
+        size_t (*countOpenCells)(const Grid&, int);
+        int (*nthOpenCell)(const Grid&, int, size_t);
+    };
+
+    // Scalar: the bodies compiled for the baseline CPU
+    static size_t scalarCountWalls(const Grid& g) { return countWallsBody(g); }
+    static size_t scalarCountDeadEnds(const Grid& g) { return countDeadEndsBody(g); }
+    static void scalarDeadEndMask(const Grid& g, Grid& out) { deadEndMaskBody(g, out); }
+    static size_t scalarCountOpenCells(const Grid& g, int y) { return countOpenCellsBody(g, y); }
+    static int scalarNthOpenCell(const Grid& g, int y, size_t n) { return nthOpenCellBody(g, y, n); }
+
+#ifdef MAZEGEN_X86_KERNELS
+
+    // Popcnt: the same bodies, compiled again with the popcount instruction enabled
+#define MAZEGEN_POPCNT __attribute__((target("popcnt")))
+    MAZEGEN_POPCNT static size_t popcntCountWalls(const Grid& g) { return countWallsBody(g); }
+    MAZEGEN_POPCNT static size_t popcntCountDeadEnds(const Grid& g) { return countDeadEndsBody(g); }
+    MAZEGEN_POPCNT static void popcntDeadEndMask(const Grid& g, Grid& out) { deadEndMaskBody(g, out); }
+    MAZEGEN_POPCNT static size_t popcntCountOpenCells(const Grid& g, int y) { return countOpenCellsBody(g, y); }
+    MAZEGEN_POPCNT static int popcntNthOpenCell(const Grid& g, int y, size_t n) { return nthOpenCellBody(g, y, n); }
+
+    /* AVX2
+
+        Four words per instruction. The words either side of a word are read with unaligned loads
+        one word before and after it, so the cross-word carries of the left/right shifts come for
+        free. AVX2 has no popcount instruction; bytes are counted with a 16-entry table lookup per
+        nibble (vpshufb) and summed per 64-bit lane with vpsadbw.
+    */
+#define MAZEGEN_AVX2 __attribute__((target("avx2,popcnt")))
+
+    MAZEGEN_AVX2 static inline __m256i popcount256(__m256i v) {
+        const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                               0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i nibble = _mm256_set1_epi8(0x0F);
+        const __m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(v, nibble));
+        const __m256i high = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+        return _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()); // 4 lane counts
+    }
+
+    MAZEGEN_AVX2 static inline size_t sumLanes(__m256i v) {
+        alignas(32) std::uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), v);
+        return static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    }
+
+    MAZEGEN_AVX2 static size_t avx2CountWalls(const Grid& grid) {
+        const Word* words = grid.Data();
+        const size_t count = grid.WordCount();
+        __m256i total = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            total = _mm256_add_epi64(total, popcount256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i))));
+        }
+        size_t walls = sumLanes(total);
+        for (; i < count; i++) walls += static_cast<size_t>(popcount64(words[i]));
+        return walls;
+    }
+
+    // Dead-end masks of words i .. i + 3 of a row. Needs words i - 1 and i + 4 to exist.
+    MAZEGEN_AVX2 static inline __m256i deadEndVector(const Word* up, const Word* row, const Word* down, size_t i) {
+        const __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+        const __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i - 1));
+        const __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i + 1));
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(up + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(down + i));
+        const __m256i c = _mm256_or_si256(_mm256_slli_epi64(cur, 1), _mm256_srli_epi64(prev, 63));
+        const __m256i d = _mm256_or_si256(_mm256_srli_epi64(cur, 1), _mm256_slli_epi64(next, 63));
+        const __m256i three = _mm256_or_si256(_mm256_and_si256(_mm256_and_si256(a, b), _mm256_xor_si256(c, d)),
+                                              _mm256_and_si256(_mm256_and_si256(c, d), _mm256_xor_si256(a, b)));
+        const __m256i open = _mm256_andnot_si256(cur, _mm256_set1_epi64x(static_cast<long long>(kOddBits)));
+        return _mm256_and_si256(open, three);
+    }
+
+    // Counts the dead ends and, when out is given, stores their masks in it. Lambdas do not inherit the
+    // target attribute, so unlike the scalar bodies this is one plain loop for both kernels.
+    MAZEGEN_AVX2 static size_t avx2DeadEnds(const Grid& grid, Grid* out) {
+        const size_t words = grid.WordsPerRow();
+        size_t count = 0;
+        __m256i total = _mm256_setzero_si256();
+        for (int y = 1; y + 1 < grid.Height(); y += 2) {
+            const Word* up = grid.Row(y - 1);
+            const Word* row = grid.Row(y);
+            const Word* down = grid.Row(y + 1);
+            Word* dest = out ? out->Row(y) : nullptr;
+
+            // Word 0 and the last words need zero neighbours / the padding mask - those go the scalar way
+            size_t i = 0;
+            for (; i < words; i++) {
+                if (i > 0 && i + 5 <= words) {
+                    const __m256i mask = deadEndVector(up, row, down, i);
+                    total = _mm256_add_epi64(total, popcount256(mask));
+                    if (dest) _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), mask);
+                    i += 3;
+                    continue;
+                }
+                const Word prev = i > 0 ? row[i - 1] : 0;
+                const Word next = i + 1 < words ? row[i + 1] : 0;
+                const Word mask = deadEndWord(up[i], down[i], prev, row[i], next, cellBits(grid, i));
+                count += static_cast<size_t>(popcount64(mask));
+                if (dest) dest[i] = mask;
+            }
+        }
+        return count + sumLanes(total);
+    }
+
+    MAZEGEN_AVX2 static size_t avx2CountDeadEnds(const Grid& grid) { return avx2DeadEnds(grid, nullptr); }
+
+    MAZEGEN_AVX2 static void avx2DeadEndMask(const Grid& grid, Grid& out) {
+        out.Assign(grid.Width(), grid.Height(), false);
+        avx2DeadEnds(grid, &out);
+    }
+
+#endif
+
+    static const KernelTable s_Kernels[] = {
+        { scalarCountWalls, scalarCountDeadEnds, scalarDeadEndMask, scalarCountOpenCells, scalarNthOpenCell },
+#ifdef MAZEGEN_X86_KERNELS
+        { popcntCountWalls, popcntCountDeadEnds, popcntDeadEndMask, popcntCountOpenCells, popcntNthOpenCell },
+        { avx2CountWalls, avx2CountDeadEnds, avx2DeadEndMask, popcntCountOpenCells, popcntNthOpenCell }, // row scans are too short to gain from vectors
+#endif
+    };
+
+    // ***********************************
+    // DISPATCH
+    // ***********************************
+
+    static const char* const s_KernelLevelNames[] = { "scalar", "popcnt", "avx2" };
+
+    const char* KernelLevelName(KernelLevel level) {
+        size_t index = static_cast<size_t>(level);
+        return index < static_cast<size_t>(KernelLevel::Count) ? s_KernelLevelNames[index] : "unknown";
+    }
+
+    KernelLevel BestKernelLevel() {
+#ifdef MAZEGEN_X86_KERNELS
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) return KernelLevel::Avx2;
+        if (__builtin_cpu_supports("popcnt")) return KernelLevel::Popcnt;
+#endif
+        return KernelLevel::Scalar;
+    }
+
+    static std::atomic<int> s_Level(-1); // -1 = not picked yet
+
+    static const KernelTable& kernels() {
+        int level = s_Level.load(std::memory_order_relaxed);
+        if (level < 0) {
+            level = static_cast<int>(BestKernelLevel());
+            s_Level.store(level, std::memory_order_relaxed);
+        }
+        return s_Kernels[level];
+    }
+
+    KernelLevel ActiveKernelLevel() {
+        kernels();
+        return static_cast<KernelLevel>(s_Level.load(std::memory_order_relaxed));
+    }
+
+    bool SetKernelLevel(KernelLevel level) {
+        if (static_cast<int>(level) < 0 || static_cast<int>(level) > static_cast<int>(BestKernelLevel())) return false;
+        s_Level.store(static_cast<int>(level), std::memory_order_relaxed);
+        return true;
+    }
+
+    // ***********************************
+    // PUBLIC KERNELS
+    // ***********************************
+
+    size_t CountWalls(const Grid& grid) { return kernels().countWalls(grid); }
+
+    double PassageRatio(const Grid& grid) {
+        if (grid.Empty()) return 0.0;
+        const double cells = static_cast<double>(grid.Width()) * static_cast<double>(grid.Height());
+        return (cells - static_cast<double>(CountWalls(grid))) / cells;
+    }
+
+    size_t CountDeadEnds(const Grid& grid) { return grid.Empty() ? 0 : kernels().countDeadEnds(grid); }
+
+    void DeadEndMask(const Grid& grid, Grid& out) { kernels().deadEndMask(grid, out); }
+
+    size_t CountOpenCells(const Grid& grid, int y) {
+        return (y < 0 || y >= grid.Height()) ? 0 : kernels().countOpenCells(grid, y);
+    }
+
+    int NthOpenCell(const Grid& grid, int y, size_t n) {
+        return (y < 0 || y >= grid.Height()) ? -1 : kernels().nthOpenCell(grid, y, n);
+    }
+
+    // ***********************************
+    // FLOOD FILL
+    // ***********************************
+
+    /* Kogge-Stone Fill
+        Spreads the seed bits g through the runs of set bits in p towards the higher bits. Each
+        step doubles the distance covered: after steps of 1, 2, 4, ... 32 a seed has reached the
+        end of its run, in 6 steps instead of up to 63. p is shrunk along the way so a step only
+        jumps over bits that are all passable.
+    */
+    static Word fillUp(Word g, Word p) {
+        g &= p;
+        g |= p & (g << 1);  p &= p << 1;
+        g |= p & (g << 2);  p &= p << 2;
+        g |= p & (g << 4);  p &= p << 4;
+        g |= p & (g << 8);  p &= p << 8;
+        g |= p & (g << 16); p &= p << 16;
+        g |= p & (g << 32);
+        return g;
+    }
+
+    static Word fillDown(Word g, Word p) { // the same towards the lower bits
+        g &= p;
+        g |= p & (g >> 1);  p &= p >> 1;
+        g |= p & (g >> 2);  p &= p >> 2;
+        g |= p & (g >> 4);  p &= p >> 4;
+        g |= p & (g >> 8);  p &= p >> 8;
+        g |= p & (g >> 16); p &= p >> 16;
+        g |= p & (g >> 32);
+        return g;
+    }
+
+    size_t FloodFill(const Grid& grid, int x, int y, Grid& reach) {
+        reach.Assign(grid.Width(), grid.Height(), false);
+        if (x < 0 || y < 0 || x >= grid.Width() || y >= grid.Height() || grid.IsWall(x, y)) return 0;
+
+        const size_t words = grid.WordsPerRow();
+        const int height = grid.Height();
+        auto passable = [&](int row, size_t i) { return ~grid.Row(row)[i] & validBits(grid, i); };
+
+        // Work list of words that may gain bits, as (row << 32 | word). queued stops a word going on twice.
+        std::vector<std::uint64_t> work;
+        std::vector<Word> queued((grid.WordCount() + 63) / 64, 0);
+        auto push = [&](int row, size_t i) {
+            const size_t index = static_cast<size_t>(row) * words + i;
+            if (queued[index / 64] & (Word(1) << (index % 64))) return;
+            queued[index / 64] |= Word(1) << (index % 64);
+            work.push_back((static_cast<std::uint64_t>(row) << 32) | i);
+        };
+
+        // Only wakes the neighbours the newly reached bits of word i can actually spread into
+        auto wake = [&](int row, size_t i, Word gained) {
+            const Word* reached = reach.Row(row) + i;
+            if (row > 0 && (gained & passable(row - 1, i) & ~reach.Row(row - 1)[i])) push(row - 1, i);
+            if (row + 1 < height && (gained & passable(row + 1, i) & ~reach.Row(row + 1)[i])) push(row + 1, i);
+            if (i > 0 && (gained & 1u) && ((passable(row, i - 1) & ~reached[-1]) >> 63)) push(row, i - 1);
+            if (i + 1 < words && (gained >> 63) && (passable(row, i + 1) & ~reached[1] & 1u)) push(row, i + 1);
+        };
+
+        const size_t start = static_cast<size_t>(x / Grid::kWordBits);
+        reach.SetWall(x, y); // "wall" bits of reach mark reached positions
+        push(y, start);
+        wake(y, start, reach.Row(y)[start]);
+
+        while (!work.empty()) {
+            const int row = static_cast<int>(work.back() >> 32);
+            const size_t i = static_cast<size_t>(work.back() & 0xFFFFFFFFu);
+            work.pop_back();
+            const size_t index = static_cast<size_t>(row) * words + i;
+            queued[index / 64] &= ~(Word(1) << (index % 64));
+
+            // Seeds: what is already reached, plus everything the neighbouring words reach into this one
+            const Word open = passable(row, i);
+            Word* reached = reach.Row(row) + i;
+            Word seeds = *reached;
+            if (row > 0) seeds |= reach.Row(row - 1)[i];
+            if (row + 1 < height) seeds |= reach.Row(row + 1)[i];
+            if (i > 0) seeds |= reached[-1] >> 63;
+            if (i + 1 < words) seeds |= reached[1] << 63;
+            seeds &= open;
+
+            const Word filled = fillUp(seeds, open) | fillDown(seeds, open);
+            const Word gained = filled & ~*reached;
+            if (gained == 0) continue;
+            *reached = filled;
+
+            wake(row, i, gained);
+        }
+
+        return CountWalls(reach);
+    }
+
+}
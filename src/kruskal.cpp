@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: kruskal.cpp
+ * Description:
+ * Implements randomized Kruskal's algorithm using a flat union-find.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "algorithm.h"
+
+namespace MazeGen {
+
+    void KruskalAlgorithm::Reserve(const CellRegion& region) {
+        m_Parent.reserve(region.CellCount());
+        m_Edges.reserve(region.CellCount() * 2); // at most a right and a down wall per cell
+    }
+
+    void KruskalAlgorithm::Carve(Grid& grid, const CellRegion& region, Rng& rng) {
+        /* Kruskal's Algorithm
+
+            Start with every cell in its own set and a list of every wall between two cells.
+            Walk the walls in random order and remove a wall only if the two cells on either side
+            are in different sets, then merge the sets. Removing a wall between cells of the same
+            set would create a loop, so those walls stay.
+
+            The sets live in a union-find stored as one flat array (parent index per cell). Path
+            halving in find() keeps the trees shallow so each lookup is close to constant time.
+            A wall is encoded as (cell index * 2 + direction), 0 = wall to the right, 1 = wall below.
+        */
+        const int cols = region.cols, rows = region.rows;
+        const size_t cellCount = region.CellCount();
+        if (cellCount == 0) return;
+
+        Reserve(region);
+        m_Parent.resize(cellCount);
+        m_Edges.clear();
+
+        for (int cy = 0; cy < rows; cy++) {
+            for (int cx = 0; cx < cols; cx++) {
+                std::uint32_t index = static_cast<std::uint32_t>(cy) * cols + cx;
+                m_Parent[index] = index;
+                grid.SetPassage(region.GridX(cx), region.GridY(cy)); // every cell is open, only walls are decided
+
+                if (cx + 1 < cols) m_Edges.push_back(index * 2 + 0);
+                if (cy + 1 < rows) m_Edges.push_back(index * 2 + 1);
+            }
+        }
+
+        rng.Shuffle(m_Edges.begin(), m_Edges.end());
+
+        auto find = [this](std::uint32_t i) {
+            while (m_Parent[i] != i) {
+                m_Parent[i] = m_Parent[m_Parent[i]];
+                i = m_Parent[i];
+            }
+            return i;
+        };
+
+        // A spanning tree has exactly (cells - 1) passages, stop as soon as they are all carved
+        size_t remaining = cellCount - 1;
+        for (std::uint32_t edge : m_Edges) {
+            if (remaining == 0) break;
+            MAZEGEN_STAT(m_Counters.steps++);
+
+            std::uint32_t index = edge >> 1;
+            bool down = edge & 1u;
+            std::uint32_t other = down ? index + cols : index + 1;
+
+            std::uint32_t a = find(index);
+            std::uint32_t b = find(other);
+            if (a == b) continue; // already connected - removing this wall would make a loop
+
+            m_Parent[b] = a;
+            remaining--;
+
+            int cx = static_cast<int>(index % cols), cy = static_cast<int>(index / cols);
+            if (down) grid.SetPassage(region.GridX(cx), region.GridY(cy) + 1);
+            else      grid.SetPassage(region.GridX(cx) + 1, region.GridY(cy));
+        }
+
+        MAZEGEN_STAT(m_Counters.cellsVisited += cellCount, m_Counters.wallsRemoved += cellCount - 1 - remaining,
+                     StatMax(m_Counters.scratchBytes, (m_Parent.capacity() + m_Edges.capacity()) * sizeof(std::uint32_t)));
+    }
+
+}
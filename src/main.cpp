@@ -2,7 +2,8 @@
  * Project: Maze Generator - Console App
  * File: main.cpp
  * Description:
- * Entry point of the application. Calls the driver run function.
+ * Entry point of the application. Calls the driver run function, or the
+ * command line driver when arguments are given.
  *
  * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
  *
@@ -12,13 +13,15 @@
  * Version: v1.0.0
  * Author: Ghost
  * Created On: 02-14-2025
- * Last Modified: 02-14-2025
+ * Last Modified: 10-17-2026
  *****************************************************************************/
 
 #include "driver.h"     
 
 using namespace MazeGen;
 
-int main() {
+int main(int argc, char* argv[]) {
+    // No arguments - interactive menu like always. Any arguments - non-interactive command line mode
+    if (argc > 1) return runCommandLine(argc, argv);
     return run();
 }
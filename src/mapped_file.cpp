@@ -0,0 +1,122 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: mapped_file.cpp
+ * Description:
+ * Implements MappedFile with mmap (Linux/Mac) or MapViewOfFile (Windows).
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "mapped_file.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>    // Used for open()
+#include <sys/mman.h> // Used for mmap()/munmap()
+#include <sys/stat.h> // Used for fstat() to get the file size
+#include <unistd.h>   // Used for close()
+#endif
+
+namespace MazeGen {
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            m_Data = other.m_Data;
+            m_Size = other.m_Size;
+            other.m_Data = nullptr;
+            other.m_Size = 0;
+#ifdef _WIN32
+            m_File = other.m_File;
+            m_Mapping = other.m_Mapping;
+            other.m_File = other.m_Mapping = nullptr;
+#endif
+        }
+        return *this;
+    }
+
+#ifdef _WIN32
+
+    bool MappedFile::Open(const std::string& filename) {
+        Close();
+
+        // FILE_SHARE_DELETE lets other handles rename or delete the file while our handle is open
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+            CloseHandle(file);
+            return false;
+        }
+
+        // PAGE_WRITECOPY + FILE_MAP_COPY is the Windows name for a private copy-on-write mapping
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) : nullptr;
+        if (!view) {
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_File = file;
+        m_Mapping = mapping;
+        m_Data = static_cast<std::uint8_t*>(view);
+        m_Size = static_cast<size_t>(size.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (m_Data) UnmapViewOfFile(m_Data);
+        if (m_Mapping) CloseHandle(static_cast<HANDLE>(m_Mapping));
+        if (m_File) CloseHandle(static_cast<HANDLE>(m_File));
+        m_Data = nullptr;
+        m_Mapping = m_File = nullptr;
+        m_Size = 0;
+    }
+
+#else
+
+    bool MappedFile::Open(const std::string& filename) {
+        Close();
+
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            close(fd);
+            return false;
+        }
+
+        // MAP_PRIVATE with write access = copy-on-write. The file itself was opened read-only and is never changed.
+        void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd); // the mapping stays valid after the descriptor is closed
+        if (data == MAP_FAILED) return false;
+
+        m_Data = static_cast<std::uint8_t*>(data);
+        m_Size = static_cast<size_t>(info.st_size);
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (m_Data) munmap(m_Data, m_Size);
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+
+#endif
+
+}
@@ -2,7 +2,7 @@
  * Project: Maze Generator - Console App
  * File: maze_gen.cpp
  * Description:
- * Implements the maze generation algorithm using recursive backtracking along with File I/O.
+ * Implements maze generation (through the selected algorithm) along with File I/O.
  *
  * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
  *
@@ -12,14 +12,16 @@
  * Version: v1.0.1
  * Author: Ghost
  * Created On: 02-14-2025
- * Last Modified: 02-21-2025
+ * Last Modified: 10-17-2026
  *****************************************************************************/
 
 #include "maze_gen.h"
-#include <vector>
-#include <fstream>    // Used for file operations (saving and loading mazes in binary format)
-#include <algorithm>  // Used for std::shuffle() in the maze generation algorithm
-#include <sstream> // Used to buffer strings in Display function before sending to cout - helps if maze is big
+#include "stream.h"   // Used for generating mazes row by row without keeping them in memory
+#include "maze_io.h"  // Used for reading and writing the binary save format
+#include "renderer.h" // Used for buffered rendering in Display
+#include "kernels.h"  // Used for the bit-parallel row scans in addEntranceAndExit
+#include <filesystem> // Used for the size of saved and loaded files in the statistics
+#include <random>     // Used for std::random_device to pick fresh seeds
 
 namespace MazeGen {
 
@@ -27,88 +29,32 @@ namespace MazeGen {
     // PRIVATE
     // ***********************************
 
-    void MazeGenerator::addEntranceAndExit() {
-
-        // Set the entrance at the top (fixed)
-        for (int x = 1; x < m_CurrentMaze.m_Width; x += 2) { // start at cell next to left/top border, move by unit of 2 to stay in structure
-            if (m_CurrentMaze.m_Grid[1][x] == ' ') { // Find a valid entry point
-                m_CurrentMaze.m_Grid[0][x] = ' '; // Open entrance
-                break;
-            }
-        }
-
-        // Find all possible exit locations on the bottom row and add that index to vector
-        std::vector<int> validExits;
-        for (int x = 1; x < m_CurrentMaze.m_Width; x += 2) {
-            if (m_CurrentMaze.m_Grid[m_CurrentMaze.m_Height - 2][x] == ' ') {
-                validExits.push_back(x); // Store all possible exits
-            }
-        }
-
-        // Pick a random exit (index) from vector, if there are valid options
-        if (!validExits.empty()) {
-            int exitIndex = validExits[m_RNG() % validExits.size()]; // Select a random valid exit
-            m_CurrentMaze.m_Grid[m_CurrentMaze.m_Height - 1][exitIndex] = ' '; // Open exit
-        }
+#if MAZEGEN_ENABLE_STATS
+    static std::uint64_t fileSize(const std::string& filename) {
+        std::error_code error;
+        std::uintmax_t size = std::filesystem::file_size(filename, error);
+        return error ? 0 : static_cast<std::uint64_t>(size);
     }
+#endif
 
-    void MazeGenerator::carveMaze(int x, int y) {
-        /* Static Variables inside function
-
-            Any variables labeled as static in a function will construct once (based on first call)
-            and will continue to exist after exiting the function. On future calls, the data
-            will be consistent to the last call. This is because the variable belongs to the 
-            function and not a specific call.
-
-            Why do this?
-            Since this function will be called a lot of times due to the recursive nature,
-            we don't want to keep reallocating these variables. Specifically:
+    void MazeGenerator::addEntranceAndExit() {
+        Grid& grid = m_CurrentMaze.m_Grid;
 
-                The dx and dy members are constant because this will not change from call to call and
-                its best to avoid this reallocation.
+        /* Row Scans
+            Both scans used to test one cell at a time. The kernels (kernels.h) test 64 cells per word with a
+            popcount instead, and the exit no longer needs a vector of every valid x to pick from - the n-th
+            open cell is found directly. The picks are the same as before, so seeds still give the same mazes.
+        */
 
-                The dirs vector will need to persist its state between calls because the elements
-                will be shuffled each time and it is best to reshuffle based on last shuffle
-                to promote more randomness - also, we don't want to keep reallocating this vector.
+        // Set the entrance at the top (fixed) - above the first open cell of the first row of cells
+        int entrance = NthOpenCell(grid, 1, 0);
+        if (entrance >= 0) grid.SetPassage(entrance, 0); // Open entrance
 
-        */
-        // Moves two cells at a time to ensure clear paths are created and walls remain intact between paths.
-        static const int dx[] = { 0,  0, -2,  2 }; // Movement offsets for Left & Right
-        static const int dy[] = { -2, 2,  0,  0 }; // Movement offsets for Up & Down
-
-        // List of direction indices (0: Up, 1: Down, 2: Left, 3: Right) - reused across function calls
-        static std::vector<int> dirs = { 0, 1, 2, 3 };
-
-        // A <algorithm> library function to randomly shuffle the directions to create unique maze structures on each generation
-        std::shuffle(dirs.begin(), dirs.end(), m_RNG);
-
-        // Mark the current cell/location (passed in as arg) as an open path (' ')
-        m_CurrentMaze.m_Grid[y][x] = ' ';
-
-        // lambda function to easily check the bounds of ny and nx(below) to ensure we are not at border or beyond
-        auto isBounds = [](int& ax, int& bound) { 
-            return (ax > 0) && (ax < bound - 1);
-        };
-
-        // Iterate through shuffled directions to determine where to move next
-        for (int dir : dirs) {
-            // Calculate the new cell coordinates by moving two steps in the chosen direction
-            // This moves in unit of 2
-            int nx = x + dx[dir]; // new x position
-            int ny = y + dy[dir]; // new y position
-
-            // Check if the new cell is within the grid boundaries and is still a wall ('#')
-            if (isBounds(ny, m_CurrentMaze.m_Height) && 
-                isBounds(nx, m_CurrentMaze.m_Width) && 
-                m_CurrentMaze.m_Grid[ny][nx] == '#') {
-
-                // Carve a passage by opening the wall between the current cell and the new cell
-                // We divide by 2 to get the actual neighbor cell (since we move by a unit of 2) and set element to space to connect passage with the current cell
-                m_CurrentMaze.m_Grid[y + dy[dir] / 2][x + dx[dir] / 2] = ' ';
-
-                // Recursively call carveMaze on the new cell to continue carving paths - will carve down to last cell and return back up
-                carveMaze(nx, ny);
-            }
+        // Pick a random exit below one of the open cells of the last row of cells, if there are valid options
+        size_t validExits = CountOpenCells(grid, m_CurrentMaze.m_Height - 2);
+        if (validExits > 0) {
+            int exitX = NthOpenCell(grid, m_CurrentMaze.m_Height - 2, m_RNG.Bounded(static_cast<std::uint32_t>(validExits))); // unbiased, unlike % size
+            grid.SetPassage(exitX, m_CurrentMaze.m_Height - 1); // Open exit
         }
     }
 
@@ -117,10 +63,12 @@ namespace MazeGen {
     // ***********************************
 
     MazeGenerator::MazeGenerator()  // default
-        : m_Width(0), m_Height(0), m_RNG(std::random_device{}()) {} 
+        : m_Width(0), m_Height(0), m_RNG(std::random_device{}()), m_FixedSeed(0), m_HasFixedSeed(false),
+          m_Algorithm(Algorithm::Backtracker), m_Engine(CreateAlgorithm(Algorithm::Backtracker)), m_Threads(1) {}
 
     MazeGenerator::MazeGenerator(int w, int h) // NEW: not in tutorial
-        :  m_RNG(std::random_device{}()) {
+        :  m_RNG(std::random_device{}()), m_FixedSeed(0), m_HasFixedSeed(false),
+           m_Algorithm(Algorithm::Backtracker), m_Engine(CreateAlgorithm(Algorithm::Backtracker)), m_Threads(1) {
             // In tutorial, we set width and height in member list
             // That may cause issue if we don't validate like we do in SetDimensions function
             // So, instead we just call it
@@ -135,17 +83,81 @@ namespace MazeGen {
         if (generate) Generate(); // Optional: Call this to automatically update the maze so the user is not working with the old one
     }
 
-    void MazeGenerator::Generate() {
+    void MazeGenerator::SetAlgorithm(Algorithm algorithm) {
+        // Only replace the algorithm object when it changes, so the current one keeps its buffers
+        if (algorithm == m_Algorithm && m_Engine) return;
 
-        // Ensure dimensions are set before generating - don't allow negative or zero values
-        if (m_Width <= 0 || m_Height <= 0) {
-            std::cout << "Set the maze dimensions first!\n";
-            return;
-        }
+        std::unique_ptr<MazeAlgorithm> engine = CreateAlgorithm(algorithm);
+        if (!engine) return; // unknown id - keep the current algorithm
+
+        m_Algorithm = algorithm;
+        m_Engine = std::move(engine);
+    }
+
+    void MazeGenerator::SetThreads(int threads) {
+        if (threads <= 0) threads = static_cast<int>(ThreadPool::HardwareThreads());
+        if (threads == m_Threads) return;
+
+        m_Threads = threads;
+        m_Tiled.reset(); // the pool is sized on creation, so a new thread count needs a new tiled generator
+    }
+
+    TiledGenerator& MazeGenerator::tiled() {
+        if (!m_Tiled) m_Tiled = std::make_unique<TiledGenerator>(static_cast<size_t>(m_Threads));
+        return *m_Tiled;
+    }
+
+    void MazeGenerator::Reserve(int w, int h) {
+        // Same odd sizes as SetDimensions
+        if (w % 2 == 0) ++w;
+        if (h % 2 == 0) ++h;
+        if (w <= 0 || h <= 0) return;
+
+        m_CurrentMaze.m_Grid.Reserve(w, h);
+        if (TiledGenerator::Tiles(w, h)) tiled().Reserve(w, h, m_Algorithm);
+        else m_Engine->Reserve(CellRegion::Full(w, h));
+    }
+
+    std::uint64_t MazeGenerator::nextSeed() const {
+        if (m_HasFixedSeed) return m_FixedSeed;
+
+        // std::random_device gives 32 bits per call, use two calls for a full 64-bit seed
+        std::random_device device;
+        return (static_cast<std::uint64_t>(device()) << 32) | device();
+    }
+
+    void MazeGenerator::SetSeed(std::uint64_t seed) {
+        m_FixedSeed = seed;
+        m_HasFixedSeed = true;
+    }
 
-        m_CurrentMaze = Maze(m_Width, m_Height); // create new maze object. Replaces the old maze object - no memory leak since m_CurrentMaze is stack allocated
-        m_RNG.seed(std::random_device{}()); // generate new seed for randomness
-        m_CurrentMaze.m_Grid.assign(m_CurrentMaze.m_Height, std::vector<char>(m_CurrentMaze.m_Width, '#')); // Fill entire grid with walls - initializes the vector to a new size and fills it
+    void MazeGenerator::ClearSeed() {
+        m_HasFixedSeed = false;
+    }
+
+    void MazeGenerator::SetRngKind(RngKind kind) {
+        m_RNG.Reset(m_RNG.GetSeed(), kind);
+    }
+
+    void MazeGenerator::generateMaze(std::uint64_t seed) {
+        // The statistics of this generation replace the last one's (the display, save and load times stay)
+        // Big mazes are tiled and small ones carved in one piece by their size alone, never by the thread count,
+        // so the same seed gives the same maze on any machine (see parallel.h)
+        const bool tiles = TiledGenerator::Tiles(m_Width, m_Height);
+        MAZEGEN_STAT(m_Stats.width = m_Width, m_Stats.height = m_Height, m_Stats.threads = tiles ? m_Threads : 1);
+        MAZEGEN_STAT(m_Stats.generateSeconds = m_Stats.carveSeconds = m_Stats.entranceSeconds = 0.0);
+        MAZEGEN_SCOPED_TIMER(m_Stats.generateSeconds);
+
+        // Reset the current maze in place instead of creating a new Maze object. Assign below keeps the grid's
+        // buffer when the size does not grow, so generating many mazes in a row does not reallocate it.
+        m_CurrentMaze.m_Width = m_Width;
+        m_CurrentMaze.m_Height = m_Height;
+        m_CurrentMaze.m_Name = "Unnamed";
+        m_CurrentMaze.m_Algorithm = m_Algorithm; // recorded so a saved maze says how to recreate it
+        m_CurrentMaze.m_RngKind = m_RNG.Kind();
+        m_CurrentMaze.m_Seed = seed;
+        m_RNG.Seed(seed);
+        m_CurrentMaze.m_Grid.Assign(m_CurrentMaze.m_Width, m_CurrentMaze.m_Height, true); // Fill entire grid with walls - sizes the packed grid and sets every bit
         /* Example 5x5 Grid - Filled matrix
                 #####
                 #####
@@ -153,108 +165,192 @@ namespace MazeGen {
                 #####
                 #####
         */
-        carveMaze(1, 1); // Recursively carve path ways, randomly starting from (1,1) position (inside border)
-        
-        addEntranceAndExit(); // adds an entrance and exit to the existing new maze
-        
-        Display(); // display the generated maze
+        // Let the selected algorithm carve path ways through every cell inside the border
+        {
+            MAZEGEN_SCOPED_TIMER(m_Stats.carveSeconds);
+            if (tiles) {
+                tiled().Carve(m_CurrentMaze.m_Grid, m_Algorithm, m_RNG); // tiles on all threads, each with a stream split from m_RNG
+            }
+            else {
+                m_Engine->ResetCounters();
+                m_Engine->Carve(m_CurrentMaze.m_Grid, CellRegion::Full(m_Width, m_Height), m_RNG);
+            }
+        }
+
+        {
+            MAZEGEN_SCOPED_TIMER(m_Stats.entranceSeconds);
+            addEntranceAndExit(); // adds an entrance and exit to the existing new maze
+        }
+
+        MAZEGEN_STAT(m_Stats.carve = tiles ? m_Tiled->Counters() : m_Engine->Counters());
+        MAZEGEN_STAT(m_Stats.gridBytes = m_CurrentMaze.m_Grid.WordCount() * sizeof(Grid::Word));
+        MAZEGEN_STAT(m_Stats.peakBytes = m_Stats.gridBytes + m_Stats.carve.scratchBytes);
     }
 
-    void MazeGenerator::Display() const {
+    MazeError MazeGenerator::Generate() {
+        return GenerateSeeded(nextSeed()); // fixed seed if one was set, otherwise a new random seed
+    }
 
-        if (m_CurrentMaze.m_Grid.empty()) { // return early if the grid is empty - happens if user attempts to display before generating or loading any mazes
-            std::cout << "There is no loaded or pre-made maze.\nPlease load or select \"Generate New Maze\"" << std::endl;
-            return;
-        } 
+    MazeError MazeGenerator::GenerateSeeded(std::uint64_t seed) {
+        // Ensure dimensions are set before generating - don't allow negative or zero values
+        if (m_Width <= 0 || m_Height <= 0) return MazeError::NoDimensions;
 
-        /* String Stream Buffer
-            The use of string stream is to avoid slowing down the process of calling cout multiple times, especially in large mazes.
-            String stream acts as a buffer, storing every string and flushing it all out at once in the end to cout. 
-        */
+        generateMaze(seed);
+        return MazeError::None;
+    }
 
-        std::stringstream ss;
-        ss << "Viewing \'" << m_CurrentMaze.m_Name << "\' maze!\n\n"; // CHANGE - Removed endl - \n is better on performance
-        
-        for (const auto& row : m_CurrentMaze.m_Grid) {
-            for (char cell : row) {
-                ss << cell;
-            }
-            ss<< '\n';
-        }
+    Result<Maze> MazeGenerator::Create() {
+        return Create(nextSeed());
+    }
+
+    Result<Maze> MazeGenerator::Create(std::uint64_t seed) {
+        MazeError error = GenerateSeeded(seed);
+        if (error != MazeError::None) return error;
 
-        std::cout << ss.str(); // flush entire contents from string stream buffer to console
+        Result<Maze> result(std::move(m_CurrentMaze)); // moves the grid's buffer - no copy of the cells
+        m_CurrentMaze = Maze();
+        return result;
     }
 
-    void MazeGenerator::SaveToFile(const std::string& filename) {
-        m_CurrentMaze.m_Name = filename; // set the current maze name to the filename
+    MazeError MazeGenerator::RegenerateRegion(const CellRegion& region) {
+        return RegenerateRegion(region, nextSeed());
+    }
 
-        std::ofstream file(filename, std::ios::binary);
+    MazeError MazeGenerator::RegenerateRegion(const CellRegion& region, std::uint64_t seed) {
+        if (m_CurrentMaze.m_Grid.Empty()) return MazeError::NoMaze;
 
-        // Ensure file is not corrupt and is open
-        if (!file || !file.is_open()) {
-            std::cerr << "Error saving the maze!\n";
-            return;
+        const CellRegion full = CellRegion::Full(m_CurrentMaze.m_Width, m_CurrentMaze.m_Height);
+        if (region.cols <= 0 || region.rows <= 0 || region.x < 0 || region.y < 0
+            || region.x + region.cols > full.cols || region.y + region.rows > full.rows) {
+            return MazeError::InvalidRegion;
         }
 
-        // Save the maze m_Name (length + content)
-        size_t nameLength = m_CurrentMaze.m_Name.size();
-        // Use write function since we are working with binary(raw) data instead of insertion which is for text base
-        // Use reinterpret_cast because write function expects a c string pointer. The second arg is the size of the data.
-        // Here we write the length of name string to file
-        file.write(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength)); 
-        // Next we write the name to file using the .data function which returns the raw array pointer to the first character of string
-        file.write(m_CurrentMaze.m_Name.data(), nameLength);
-
-        // We save the width and height
-        file.write(reinterpret_cast<const char*>(&m_CurrentMaze.m_Width), sizeof(m_CurrentMaze.m_Width));
-        file.write(reinterpret_cast<const char*>(&m_CurrentMaze.m_Height), sizeof(m_CurrentMaze.m_Height));
-
-        // Finally, Save maze m_Grid vector using the .data, per row, which returns a pointer to the first element
-        for (const auto& row : m_CurrentMaze.m_Grid) {
-            file.write(row.data(), row.size());
-        }
+        Rng rng(seed, m_RNG.Kind()); // own generator - m_RNG and GetSeed keep describing the generated maze
+        m_Regenerator.Regenerate(m_CurrentMaze.m_Grid, region, rng);
+        return MazeError::None;
+    }
+
+    void MazeGenerator::SetMazeName(const std::string& name) {
+        m_CurrentMaze.m_Name = name;
+    }
+
+    MazeError MazeGenerator::Display(std::FILE* out) const {
+        return display(m_RenderOptions, out);
+    }
+
+    MazeError MazeGenerator::display(const RenderOptions& options, std::FILE* file) const {
+
+        // return early if the grid is empty - happens if user attempts to display before generating or loading any mazes
+        if (m_CurrentMaze.m_Grid.Empty()) return MazeError::NoMaze;
+
+        /* Output Buffer
+            The first version pushed every cell into a std::stringstream and then copied the whole text into a string
+            before printing it - two full copies of the maze in memory, and one stream operation per cell.
+            The renderer (renderer.h) instead expands packed rows straight into a fixed 64 KB buffer and writes the
+            buffer out each time it fills up, so the memory used stays the same however big the maze is.
+        */
+        MAZEGEN_STAT(m_Stats.displaySeconds = 0.0);
+        MAZEGEN_SCOPED_TIMER(m_Stats.displaySeconds);
+
+        OutputBuffer out(file, options.bufferSize);
+        out.Append("Viewing \'" + m_CurrentMaze.m_Name + "\' maze!\n\n");
+        RenderGrid(m_CurrentMaze.m_Grid, out, options);
 
-        std::cout << "Maze saved to " << filename << " successfully!\n";
+        // fwrite only fills the FILE's own buffer, a closed pipe or full disk shows up when it is flushed
+        const bool written = out.Flush() && std::fflush(file) == 0;
+        return written ? MazeError::None : MazeError::WriteFailed;
     }
 
-    bool MazeGenerator::LoadFromFile(const std::string& filename) {
+    MazeError MazeGenerator::Solve(SolveMethod method, std::FILE* out) {
+        if (m_CurrentMaze.m_Grid.Empty()) return MazeError::NoMaze;
 
-        std::ifstream file(filename, std::ios::binary);
+        if (!m_Solver.Solve(m_CurrentMaze.m_Grid, method, m_Solution)) return MazeError::NoSolution;
 
-        // Ensure file is not corrupt and is open
-        if (!file || !file.is_open()) {
-            std::cerr << "Error loading the maze! File may not exist.\n";
-            return false;
+        // Draw the path over the maze - the maze itself is not changed
+        MarkSolution(m_Solution, m_SolutionOverlay);
+        RenderOptions options = m_RenderOptions;
+        options.overlay = &m_SolutionOverlay;
+        return display(options, out);
+    }
+
+    MazeError MazeGenerator::SaveToFile(const std::string& filename, bool compress) {
+        if (m_CurrentMaze.m_Grid.Empty()) return MazeError::NoMaze;
+
+        m_CurrentMaze.m_Name = filename; // set the current maze name to the filename
+
+#ifdef _WIN32
+        // Windows will not replace a file while a view of it is mapped, and a loaded maze may be mapped from the very
+        // file being saved. Copy the cells into memory first so the mapping is released (see maze_io.h).
+        if (m_CurrentMaze.m_Grid.IsExternal()) m_CurrentMaze.m_Grid = Grid(m_CurrentMaze.m_Grid);
+#endif
+
+        // Header, name and packed cells go out in a single write (see maze_io.h for the layout)
+        MazeError error;
+        MAZEGEN_STAT(m_Stats.saveSeconds = 0.0);
+        {
+            MAZEGEN_SCOPED_TIMER(m_Stats.saveSeconds);
+            error = SaveMazeFile(filename, m_CurrentMaze, compress);
         }
+        if (error != MazeError::None) return error;
+        MAZEGEN_STAT(m_Stats.savedBytes = fileSize(filename));
 
-        size_t nameLength;
-        // Use read function since we are working with binary(raw) data instead of insertion which is for text base
-        // We read in order of save structure starting with size of name string
-        file.read(reinterpret_cast<char*>(&nameLength), sizeof(nameLength));
-        // Use the size to resize the string of maze m_Name member
-        m_CurrentMaze.m_Name.resize(nameLength);
-        // Read the name and assign it to the maze m_Name member starting at first character - which is why we needed to save the size
-        file.read(&m_CurrentMaze.m_Name[0], nameLength);
-
-        // Load m_Width and m_Height and assign to the maze members
-        file.read(reinterpret_cast<char*>(&m_CurrentMaze.m_Width), sizeof(m_CurrentMaze.m_Width));
-        file.read(reinterpret_cast<char*>(&m_CurrentMaze.m_Height), sizeof(m_CurrentMaze.m_Height));
-
-        // Use the width and height information to resize the grid of current maze
-        m_CurrentMaze.m_Grid.assign(m_CurrentMaze.m_Height, std::vector<char>(m_CurrentMaze.m_Width));
-
-        // Load each row of grid from file into maze m_Grid starting at first element
-        for (auto& row : m_CurrentMaze.m_Grid) {
-            file.read(row.data(), row.size());
+        return MazeError::None;
+    }
+
+    MazeError MazeGenerator::LoadFromFile(const std::string& filename) {
+
+        // Maps the file and detects the binary or legacy format from its first bytes. An uncompressed binary
+        // maze is checked and then used straight from the mapping, so even huge files are never copied (see maze_io.h).
+        MazeError error;
+        MAZEGEN_STAT(m_Stats.loadSeconds = 0.0);
+        {
+            MAZEGEN_SCOPED_TIMER(m_Stats.loadSeconds);
+            error = LoadMazeFile(filename, m_CurrentMaze, LoadMode::Map);
         }
+        if (error != MazeError::None) {
+            m_CurrentMaze = Maze(); // never keep a half loaded maze around
+            return error;
+        }
+        MAZEGEN_STAT(m_Stats.loadedBytes = fileSize(filename));
 
         // Update generator dimensions, not the maze dimensions. This ensure we are working on this dimension now for future maze generations
         m_Width = m_CurrentMaze.m_Width;
         m_Height = m_CurrentMaze.m_Height;
 
-        std::cout << "Maze '" << m_CurrentMaze.m_Name << "' loaded from " << filename << " successfully!\n";
+        return MazeError::None;
+    }
+
+    MazeError MazeGenerator::ExportToFile(const std::string& filename, ExportFormat format, int scale) const {
+        if (m_CurrentMaze.m_Grid.Empty()) return MazeError::NoMaze;
+        return ExportGrid(filename, m_CurrentMaze.m_Grid, format, scale);
+    }
+
+    // StreamMaze only fails on sizes it cannot lay out, or when the sink fails to write - so the sizes are checked first
+    static MazeError checkStreamDimensions(int width, int height) {
+        if (width <= 0 || height <= 0) return MazeError::NoDimensions;
+        if (width < 3 || height < 3 || width % 2 == 0 || height % 2 == 0) return MazeError::BadDimensions;
+        return MazeError::None;
+    }
+
+    MazeError MazeGenerator::StreamToFile(const std::string& filename) {
+        const MazeError error = checkStreamDimensions(m_Width, m_Height);
+        if (error != MazeError::None) return error; // before the file is created
+
+        m_RNG.Seed(nextSeed()); // same seed rules as Generate
+
+        FileRowSink sink(filename, m_RNG.GetSeed(), m_RNG.Kind()); // the record says how to recreate the maze
+        if (!sink.IsOpen()) return MazeError::OpenFailed; // same error as SaveToFile - nothing was written yet
+        return StreamMaze(m_Width, m_Height, m_RNG, sink) ? MazeError::None : MazeError::WriteFailed;
+    }
+
+    MazeError MazeGenerator::StreamToConsole() {
+        const MazeError error = checkStreamDimensions(m_Width, m_Height);
+        if (error != MazeError::None) return error;
+
+        m_RNG.Seed(nextSeed());
 
-        return true;
+        ConsoleRowSink sink;
+        return StreamMaze(m_Width, m_Height, m_RNG, sink) ? MazeError::None : MazeError::WriteFailed;
     }
 
 }
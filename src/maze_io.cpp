@@ -0,0 +1,479 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: maze_io.cpp
+ * Description:
+ * Implements reading and writing mazes in the binary save file formats.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "maze_io.h"
+#include "checksum.h" // Used for the header and payload checksums
+#include "compress.h" // Used for the optional payload compression
+#include "mapped_file.h" // Used for the memory-mapped load mode
+#include <cstdio>     // Used for std::fopen/std::fwrite/std::fread - one bulk call per file
+#include <cstring>    // Used for std::memcpy()
+#include <filesystem> // Used for replacing the old file once the new one is complete
+#include <istream>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace MazeGen {
+
+    bool WriteLegacyHeader(std::ostream& out, const std::string& name, int width, int height) {
+        // Save the maze name (length + content)
+        size_t nameLength = name.size();
+        // Use write function since we are working with binary(raw) data instead of insertion which is for text base
+        // Use reinterpret_cast because write function expects a c string pointer. The second arg is the size of the data.
+        // Here we write the length of name string to file
+        out.write(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength));
+        // Next we write the name to file using the .data function which returns the raw array pointer to the first character of string
+        out.write(name.data(), nameLength);
+
+        // We save the width and height
+        out.write(reinterpret_cast<const char*>(&width), sizeof(width));
+        out.write(reinterpret_cast<const char*>(&height), sizeof(height));
+
+        return static_cast<bool>(out);
+    }
+
+    bool WriteLegacyMaze(std::ostream& out, const Maze& maze) {
+        if (!WriteLegacyHeader(out, maze.m_Name, maze.m_Width, maze.m_Height)) return false;
+
+        // Finally, Save the maze grid one row at a time. The file keeps one character per cell, so each packed row
+        // is expanded into '#' and ' ' before writing - this keeps old save files and new ones compatible
+        std::vector<char> line(maze.m_Grid.Width());
+        for (int y = 0; y < maze.m_Grid.Height(); y++) {
+            maze.m_Grid.RowToChars(y, line.data());
+            out.write(line.data(), line.size());
+        }
+
+        return static_cast<bool>(out);
+    }
+
+    bool ReadLegacyMaze(std::istream& in, Maze& maze) {
+        size_t nameLength;
+        // Use read function since we are working with binary(raw) data instead of insertion which is for text base
+        // We read in order of save structure starting with size of name string
+        in.read(reinterpret_cast<char*>(&nameLength), sizeof(nameLength));
+        if (!in) return false;
+        // Use the size to resize the string of maze m_Name member
+        maze.m_Name.resize(nameLength);
+        // Read the name and assign it to the maze m_Name member starting at first character - which is why we needed to save the size
+        in.read(&maze.m_Name[0], nameLength);
+
+        // Load m_Width and m_Height and assign to the maze members
+        in.read(reinterpret_cast<char*>(&maze.m_Width), sizeof(maze.m_Width));
+        in.read(reinterpret_cast<char*>(&maze.m_Height), sizeof(maze.m_Height));
+        if (!in) return false;
+
+        // Use the width and height information to resize the grid of current maze
+        maze.m_Grid.Assign(maze.m_Width, maze.m_Height);
+
+        // Load each row of characters from file and pack it into the grid
+        std::vector<char> line(maze.m_Width > 0 ? maze.m_Width : 0);
+        for (int y = 0; y < maze.m_Height; y++) {
+            in.read(line.data(), line.size());
+            maze.m_Grid.RowFromChars(y, line.data());
+        }
+
+        return static_cast<bool>(in);
+    }
+
+    // ***********************************
+    // BINARY FORMAT
+    // ***********************************
+
+    static const std::uint8_t kMagic[4] = { 'M', 'A', 'Z', 'E' };
+    static constexpr std::uint16_t kFlagCompressed = 1;
+    static constexpr std::uint16_t kFlagKnownMask = kFlagCompressed;
+    static constexpr size_t kPayloadAlign = 64;
+
+    // Byte order helpers - the file is little-endian on every machine
+    static void put16(std::uint8_t* p, std::uint16_t v) { for (int i = 0; i < 2; i++) p[i] = static_cast<std::uint8_t>(v >> (8 * i)); }
+    static void put32(std::uint8_t* p, std::uint32_t v) { for (int i = 0; i < 4; i++) p[i] = static_cast<std::uint8_t>(v >> (8 * i)); }
+    static void put64(std::uint8_t* p, std::uint64_t v) { for (int i = 0; i < 8; i++) p[i] = static_cast<std::uint8_t>(v >> (8 * i)); }
+
+    static std::uint16_t get16(const std::uint8_t* p) { return static_cast<std::uint16_t>(p[0] | p[1] << 8); }
+    static std::uint32_t get32(const std::uint8_t* p) {
+        std::uint32_t v = 0;
+        for (int i = 3; i >= 0; i--) v = (v << 8) | p[i];
+        return v;
+    }
+    static std::uint64_t get64(const std::uint8_t* p) {
+        std::uint64_t v = 0;
+        for (int i = 7; i >= 0; i--) v = (v << 8) | p[i];
+        return v;
+    }
+
+    static bool littleEndianHost() {
+        const std::uint16_t probe = 1;
+        std::uint8_t first;
+        std::memcpy(&first, &probe, 1);
+        return first == 1; // folded to a constant by the compiler
+    }
+
+    static Grid::Word byteSwap(Grid::Word w) {
+        Grid::Word r = 0;
+        for (int i = 0; i < 8; i++, w >>= 8) r = (r << 8) | (w & 0xFFu);
+        return r;
+    }
+
+    /* Bit Plane Filter
+
+        In a generated maze every post (even x, even y) is a wall and every cell (odd x, odd y) is a
+        passage, so half of the bits never change - but they alternate with the bits that do, and a
+        byte based compressor cannot see that. Before compressing, each row is rearranged so all its
+        even-x bits come first and all its odd-x bits after. The fixed halves then become long runs
+        of equal bytes, which LZ stores in a few bytes. The filter is lossless for any grid.
+    */
+    static std::uint64_t evenBits(std::uint64_t w) { // gathers bits 0, 2, 4, ... into the low 32 bits
+        w &= 0x5555555555555555ull;
+        w = (w | (w >> 1)) & 0x3333333333333333ull;
+        w = (w | (w >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+        w = (w | (w >> 4)) & 0x00FF00FF00FF00FFull;
+        w = (w | (w >> 8)) & 0x0000FFFF0000FFFFull;
+        w = (w | (w >> 16)) & 0x00000000FFFFFFFFull;
+        return w;
+    }
+
+    static std::uint64_t spreadBits(std::uint64_t w) { // the reverse: low 32 bits back to bits 0, 2, 4, ...
+        w &= 0x00000000FFFFFFFFull;
+        w = (w | (w << 16)) & 0x0000FFFF0000FFFFull;
+        w = (w | (w << 8)) & 0x00FF00FF00FF00FFull;
+        w = (w | (w << 4)) & 0x0F0F0F0F0F0F0F0Full;
+        w = (w | (w << 2)) & 0x3333333333333333ull;
+        w = (w | (w << 1)) & 0x5555555555555555ull;
+        return w;
+    }
+
+    // Writes the filtered rows as little-endian bytes: per row, the even halves of every word, then the odd halves
+    static void splitPlanes(const Grid& grid, std::vector<std::uint8_t>& out) {
+        const size_t words = grid.WordsPerRow();
+        out.resize(grid.ByteSize());
+        std::uint8_t* p = out.data();
+        for (int y = 0; y < grid.Height(); y++, p += words * 8) {
+            const Grid::Word* row = grid.Row(y);
+            for (size_t i = 0; i < words; i++) {
+                put32(p + 4 * i, static_cast<std::uint32_t>(evenBits(row[i])));
+                put32(p + 4 * (words + i), static_cast<std::uint32_t>(evenBits(row[i] >> 1)));
+            }
+        }
+    }
+
+    static void joinPlanes(const std::uint8_t* in, Grid& grid) {
+        const size_t words = grid.WordsPerRow();
+        for (int y = 0; y < grid.Height(); y++, in += words * 8) {
+            Grid::Word* row = grid.Row(y);
+            for (size_t i = 0; i < words; i++) {
+                row[i] = spreadBits(get32(in + 4 * i)) | (spreadBits(get32(in + 4 * (words + i))) << 1);
+            }
+        }
+    }
+
+    // Fills the 64 byte header and the name. The payload checksum goes in before the header checksum, which covers it.
+    static void writeHeader(std::uint8_t* record, const Maze& maze, std::uint16_t flags, size_t payloadOffset,
+                            size_t storedSize, size_t rawSize, std::uint32_t payloadCrc) {
+        std::memcpy(record, kMagic, 4);
+        put16(record + 4, kMazeFormatVersion);
+        put16(record + 6, flags);
+        put32(record + 8, static_cast<std::uint32_t>(maze.m_Width));
+        put32(record + 12, static_cast<std::uint32_t>(maze.m_Height));
+        record[16] = static_cast<std::uint8_t>(maze.m_Algorithm);
+        record[17] = static_cast<std::uint8_t>(maze.m_RngKind);
+        put32(record + 20, static_cast<std::uint32_t>(maze.m_Name.size()));
+        put64(record + 24, maze.m_Seed);
+        put64(record + 32, payloadOffset);
+        put64(record + 40, storedSize);
+        put64(record + 48, rawSize);
+        put32(record + 56, payloadCrc);
+
+        std::memcpy(record + kMazeHeaderSize, maze.m_Name.data(), maze.m_Name.size());
+        put32(record + 60, Crc32(record + kMazeHeaderSize, maze.m_Name.size(), Crc32(record, 60)));
+    }
+
+    static size_t payloadOffsetFor(const Maze& maze) {
+        return (kMazeHeaderSize + maze.m_Name.size() + kPayloadAlign - 1) / kPayloadAlign * kPayloadAlign;
+    }
+
+    void EncodeMaze(const Maze& maze, std::vector<std::uint8_t>& out, bool compress) {
+        const Grid& grid = maze.m_Grid;
+        const size_t rawSize = grid.ByteSize();
+        const size_t payloadOffset = payloadOffsetFor(maze);
+
+        // Compressed positions are 32-bit, so very large payloads are always stored as they are
+        std::vector<std::uint8_t> packed;
+        if (compress && rawSize > 0 && rawSize <= std::numeric_limits<std::uint32_t>::max()) {
+            std::vector<std::uint8_t> planes;
+            splitPlanes(grid, planes);
+            CompressBlock(planes.data(), planes.size(), packed);
+            if (packed.size() >= rawSize) packed.clear(); // did not help - store raw
+        }
+
+        // An uncompressed payload is the grid's own words. On a big-endian machine they are byte swapped into a copy first.
+        const std::uint8_t* words = reinterpret_cast<const std::uint8_t*>(grid.Data());
+        std::vector<Grid::Word> swapped;
+        if (packed.empty() && !littleEndianHost()) {
+            swapped.resize(grid.WordCount());
+            for (size_t i = 0; i < swapped.size(); i++) swapped[i] = byteSwap(grid.Data()[i]);
+            words = reinterpret_cast<const std::uint8_t*>(swapped.data());
+        }
+        const bool compressed = !packed.empty();
+        const std::uint8_t* payload = compressed ? packed.data() : words;
+        const size_t storedSize = compressed ? packed.size() : rawSize;
+
+        // Header + name + padding + payload are laid out in one buffer so the caller can write it in one call
+        const size_t start = out.size();
+        out.resize(start + payloadOffset + storedSize, 0);
+        std::uint8_t* record = out.data() + start;
+
+        if (storedSize > 0) std::memcpy(record + payloadOffset, payload, storedSize);
+        writeHeader(record, maze, compressed ? kFlagCompressed : 0, payloadOffset, storedSize, rawSize,
+                    Crc32(record + payloadOffset, storedSize));
+    }
+
+    void EncodeMazeHeader(const Maze& maze, std::uint32_t payloadCrc, std::vector<std::uint8_t>& out) {
+        const size_t payloadOffset = payloadOffsetFor(maze);
+        const size_t wordsPerRow = (static_cast<size_t>(maze.m_Width) + Grid::kWordBits - 1) / Grid::kWordBits;
+        const size_t rawSize = wordsPerRow * static_cast<size_t>(maze.m_Height) * sizeof(Grid::Word);
+
+        out.assign(payloadOffset, 0);
+        writeHeader(out.data(), maze, 0, payloadOffset, rawSize, rawSize, payloadCrc);
+    }
+
+    void EncodeRow(const Grid& grid, int y, std::vector<std::uint8_t>& out) {
+        const Grid::Word* row = grid.Row(y);
+        const size_t start = out.size();
+        out.resize(start + grid.WordsPerRow() * sizeof(Grid::Word));
+        for (size_t i = 0; i < grid.WordsPerRow(); i++) {
+            const Grid::Word word = littleEndianHost() ? row[i] : byteSwap(row[i]);
+            std::memcpy(out.data() + start + i * sizeof(Grid::Word), &word, sizeof(word));
+        }
+    }
+
+    bool IsBinaryMaze(const std::uint8_t* data, size_t size) {
+        return size >= sizeof(kMagic) && std::memcmp(data, kMagic, sizeof(kMagic)) == 0;
+    }
+
+    // The header fields of a record, once checked against the data they came with
+    struct RecordInfo {
+        std::uint16_t flags;
+        std::uint32_t width, height, nameLength;
+        std::uint64_t payloadOffset, storedSize, rawSize;
+    };
+
+    // Validates the header, the sizes and the header checksum. The payload checksum is left to the caller,
+    // because checking it reads every byte of the payload.
+    static bool readRecordInfo(const std::uint8_t* data, size_t size, RecordInfo& info) {
+        if (size < kMazeHeaderSize || !IsBinaryMaze(data, size)) return false;
+        if (get16(data + 4) != kMazeFormatVersion) return false;
+
+        info.flags = get16(data + 6);
+        if (info.flags & ~kFlagKnownMask) return false; // written by a newer version with features we do not understand
+        info.width = get32(data + 8);
+        info.height = get32(data + 12);
+        info.nameLength = get32(data + 20);
+        info.payloadOffset = get64(data + 32);
+        info.storedSize = get64(data + 40);
+        info.rawSize = get64(data + 48);
+
+        // Check every size against the data we actually have before trusting any of them
+        if (info.width == 0 || info.height == 0 || info.width > static_cast<std::uint32_t>(std::numeric_limits<int>::max()) ||
+            info.height > static_cast<std::uint32_t>(std::numeric_limits<int>::max())) return false;
+        if (info.payloadOffset < kMazeHeaderSize + std::uint64_t(info.nameLength) || info.payloadOffset > size) return false;
+        if (info.storedSize > size - info.payloadOffset) return false;
+
+        const std::uint64_t wordsPerRow = (std::uint64_t(info.width) + Grid::kWordBits - 1) / Grid::kWordBits;
+        if (info.rawSize != wordsPerRow * info.height * sizeof(Grid::Word)) return false;
+        const bool compressed = (info.flags & kFlagCompressed) != 0;
+        if (!compressed && info.storedSize != info.rawSize) return false;
+        if (compressed && info.rawSize / 255 > info.storedSize + 16) return false; // more than LZ can expand to - refuse the allocation
+
+        if (get32(data + 60) != Crc32(data + kMazeHeaderSize, info.nameLength, Crc32(data, 60))) return false;
+
+        return data[16] < static_cast<std::uint8_t>(Algorithm::Count) && data[17] < static_cast<std::uint8_t>(RngKind::Count);
+    }
+
+    static void readRecordFields(const std::uint8_t* data, const RecordInfo& info, Maze& maze) {
+        maze.m_Width = static_cast<int>(info.width);
+        maze.m_Height = static_cast<int>(info.height);
+        maze.m_Name.assign(reinterpret_cast<const char*>(data + kMazeHeaderSize), info.nameLength);
+        maze.m_Algorithm = static_cast<Algorithm>(data[16]);
+        maze.m_RngKind = static_cast<RngKind>(data[17]);
+        maze.m_Seed = get64(data + 24);
+    }
+
+    size_t DecodeMaze(const std::uint8_t* data, size_t size, Maze& maze) {
+        RecordInfo info;
+        if (!readRecordInfo(data, size, info)) return 0;
+
+        const std::uint8_t* payload = data + info.payloadOffset;
+        const size_t storedSize = static_cast<size_t>(info.storedSize);
+        if (get32(data + 56) != Crc32(payload, storedSize)) return 0;
+
+        // Header is good - fill the maze
+        readRecordFields(data, info, maze);
+
+        Grid& grid = maze.m_Grid;
+        grid.Assign(maze.m_Width, maze.m_Height, false);
+
+        if (info.flags & kFlagCompressed) {
+            std::vector<std::uint8_t> planes(grid.ByteSize());
+            if (!DecompressBlock(payload, storedSize, planes.data(), planes.size())) return 0;
+            joinPlanes(planes.data(), grid); // byte order is handled by get32
+        }
+        else {
+            std::memcpy(grid.Data(), payload, grid.ByteSize());
+            if (!littleEndianHost()) {
+                for (size_t i = 0; i < grid.WordCount(); i++) grid.Data()[i] = byteSwap(grid.Data()[i]);
+            }
+        }
+
+        // Keep the padding bits of every row at 0, as the Grid requires, even if the file set them
+        const int tailBits = maze.m_Width % Grid::kWordBits;
+        if (tailBits != 0) {
+            const Grid::Word mask = (Grid::Word(1) << tailBits) - 1;
+            for (int y = 0; y < maze.m_Height; y++) grid.Row(y)[grid.WordsPerRow() - 1] &= mask;
+        }
+
+        return static_cast<size_t>(info.payloadOffset) + storedSize;
+    }
+
+    // Legacy records parsed straight from a memory buffer, with the sizes checked against the buffer
+    static bool decodeLegacy(const std::uint8_t* data, size_t size, Maze& maze) {
+        size_t nameLength;
+        int width, height;
+        if (size < sizeof(nameLength)) return false;
+        std::memcpy(&nameLength, data, sizeof(nameLength));
+        if (nameLength > size - sizeof(nameLength) || size - sizeof(nameLength) - nameLength < 2 * sizeof(int)) return false;
+
+        const std::uint8_t* p = data + sizeof(nameLength);
+        std::string name(reinterpret_cast<const char*>(p), nameLength);
+        p += nameLength;
+        std::memcpy(&width, p, sizeof(width));
+        std::memcpy(&height, p + sizeof(width), sizeof(height));
+        p += 2 * sizeof(int);
+
+        const size_t left = size - static_cast<size_t>(p - data);
+        if (width <= 0 || height <= 0 || static_cast<size_t>(width) > left / static_cast<size_t>(height)) return false;
+
+        maze = Maze(width, height);
+        maze.m_Name = std::move(name);
+        maze.m_Grid.Assign(width, height);
+        for (int y = 0; y < height; y++, p += width) {
+            maze.m_Grid.RowFromChars(y, reinterpret_cast<const char*>(p));
+        }
+        return true;
+    }
+
+    std::string TempFileName(const std::string& filename) {
+        return filename + ".part";
+    }
+
+    bool ReplaceFile(const std::string& from, const std::string& to) {
+        std::error_code ec;
+        std::filesystem::rename(from, to, ec); // replaces the directory entry - a mapping of the old file stays valid
+        if (ec) std::filesystem::remove(from, ec);
+        return !ec;
+    }
+
+    MazeError SaveMazeFile(const std::string& filename, const Maze& maze, bool compress) {
+        std::vector<std::uint8_t> record;
+        EncodeMaze(maze, record, compress);
+
+        const std::string temp = TempFileName(filename);
+        std::FILE* file = std::fopen(temp.c_str(), "wb");
+        if (!file) return MazeError::OpenFailed;
+
+        bool ok = std::fwrite(record.data(), 1, record.size(), file) == record.size();
+        ok = (std::fclose(file) == 0) && ok;
+        if (!ok) {
+            std::remove(temp.c_str());
+            return MazeError::WriteFailed;
+        }
+        return ReplaceFile(temp, filename) ? MazeError::None : MazeError::WriteFailed;
+    }
+
+    // Decodes a whole file image in either format
+    static MazeError decodeFile(const std::uint8_t* data, size_t size, Maze& maze) {
+        bool ok = IsBinaryMaze(data, size) ? DecodeMaze(data, size, maze) != 0 : decodeLegacy(data, size, maze);
+        return ok ? MazeError::None : MazeError::InvalidFile;
+    }
+
+    MazeError LoadMazeFile(const std::string& filename, Maze& maze, LoadMode mode) {
+        if (mode != LoadMode::Read) {
+            auto file = std::make_shared<MappedFile>();
+            if (!file->Open(filename)) return MazeError::OpenFailed;
+
+            const std::uint8_t* data = file->Data();
+            RecordInfo info;
+            const bool inPlace = IsBinaryMaze(data, file->Size()) && readRecordInfo(data, file->Size(), info) &&
+                                 !(info.flags & kFlagCompressed) && littleEndianHost() &&
+                                 reinterpret_cast<std::uintptr_t>(data + info.payloadOffset) % alignof(Grid::Word) == 0;
+
+            if (inPlace) {
+                // The grid points straight at the mapped payload and keeps the mapping alive - the payload is never copied
+                Grid::Word* words = reinterpret_cast<Grid::Word*>(file->Data() + info.payloadOffset);
+                const size_t storedSize = static_cast<size_t>(info.storedSize);
+
+                if (mode == LoadMode::Map) {
+                    // Checking reads the payload once through the mapping. Padding bits the file set are cleared in our
+                    // private copy-on-write pages, so the Grid's rule holds; only pages that needed it get copied.
+                    if (get32(data + 56) != Crc32(data + info.payloadOffset, storedSize)) return MazeError::InvalidFile;
+
+                    const size_t wordsPerRow = (size_t(info.width) + Grid::kWordBits - 1) / Grid::kWordBits;
+                    const int tailBits = static_cast<int>(info.width % Grid::kWordBits);
+                    if (tailBits != 0) {
+                        const Grid::Word mask = (Grid::Word(1) << tailBits) - 1;
+                        for (size_t y = 0; y < info.height; y++) {
+                            Grid::Word& last = words[y * wordsPerRow + wordsPerRow - 1];
+                            if (last & ~mask) last &= mask;
+                        }
+                    }
+                }
+
+                readRecordFields(data, info, maze);
+                maze.m_Grid.Adopt(maze.m_Width, maze.m_Height, words, std::move(file));
+                return MazeError::None;
+            }
+
+            // Compressed and legacy files are decoded straight from the mapping - still no extra copy of the file
+            return decodeFile(data, file->Size(), maze);
+        }
+
+        std::FILE* file = std::fopen(filename.c_str(), "rb");
+        if (!file) return MazeError::OpenFailed;
+
+        // Size the buffer from the file length and read the whole file in one call
+        std::vector<std::uint8_t> data;
+        bool ok = std::fseek(file, 0, SEEK_END) == 0;
+        long length = ok ? std::ftell(file) : -1;
+        ok = ok && length >= 0 && std::fseek(file, 0, SEEK_SET) == 0;
+        if (ok) {
+            data.resize(static_cast<size_t>(length));
+            ok = std::fread(data.data(), 1, data.size(), file) == data.size();
+        }
+        std::fclose(file);
+        if (!ok) return MazeError::ReadFailed;
+
+        return decodeFile(data.data(), data.size(), maze);
+    }
+
+    Result<Maze> LoadMaze(const std::string& filename, LoadMode mode) {
+        Maze maze;
+        MazeError error = LoadMazeFile(filename, maze, mode);
+        if (error != MazeError::None) return error;
+        return Result<Maze>(std::move(maze));
+    }
+
+}
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: parallel.cpp
+ * Description:
+ * Implements tiled, multi-threaded maze generation with seam stitching.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "parallel.h"
+#include <algorithm>  // Used for std::min()
+
+namespace MazeGen {
+
+    TiledGenerator::TiledGenerator(size_t threads)
+        : m_Pool(threads), m_TileCells(kDefaultTileCells) {}
+
+    bool TiledGenerator::Tiles(int width, int height) {
+        const CellRegion full = CellRegion::Full(width, height);
+        return full.cols > kDefaultTileCells || full.rows > kDefaultTileCells;
+    }
+
+    void TiledGenerator::SetTileSize(int cells) {
+        if (cells < kTileAlign) cells = kTileAlign;
+        m_TileCells = (cells + kTileAlign - 1) / kTileAlign * kTileAlign;
+    }
+
+    void TiledGenerator::prepareEngines(Algorithm algorithm) {
+        // Make sure every worker has an algorithm object of the requested kind (they keep their buffers)
+        m_Engines.resize(m_Pool.Size());
+        for (auto& engine : m_Engines) {
+            if (!engine || engine->Id() != algorithm) engine = CreateAlgorithm(algorithm);
+        }
+    }
+
+    void TiledGenerator::Reserve(int width, int height, Algorithm algorithm) {
+        const CellRegion full = CellRegion::Full(width, height);
+        if (full.cols <= 0 || full.rows <= 0) return;
+
+        // Any worker may carve any tile, so every engine is sized for a whole tile
+        const CellRegion tile = { 0, 0, std::min(m_TileCells, full.cols), std::min(m_TileCells, full.rows) };
+        prepareEngines(algorithm);
+        for (auto& engine : m_Engines) engine->Reserve(tile);
+
+        const size_t tileCount = static_cast<size_t>((full.cols + m_TileCells - 1) / m_TileCells) * ((full.rows + m_TileCells - 1) / m_TileCells);
+        m_Parent.reserve(tileCount);
+        m_Edges.reserve(tileCount * 2);
+    }
+
+    void TiledGenerator::Carve(Grid& grid, Algorithm algorithm, const Rng& baseRng) {
+        const CellRegion full = CellRegion::Full(grid.Width(), grid.Height());
+        if (full.cols <= 0 || full.rows <= 0) return;
+
+        const int tile = m_TileCells;
+        const int tilesX = (full.cols + tile - 1) / tile;
+        const int tilesY = (full.rows + tile - 1) / tile;
+        const size_t tileCount = static_cast<size_t>(tilesX) * tilesY;
+
+        prepareEngines(algorithm);
+        for (auto& engine : m_Engines) engine->ResetCounters();
+
+        auto tileRegion = [&](size_t index) {
+            int tx = static_cast<int>(index % tilesX), ty = static_cast<int>(index / tilesX);
+            CellRegion region;
+            region.x = tx * tile;
+            region.y = ty * tile;
+            region.cols = std::min(tile, full.cols - region.x);
+            region.rows = std::min(tile, full.rows - region.y);
+            return region;
+        };
+
+        // 1. Carve every tile in parallel, each with its own random stream
+        auto carveTile = [&](size_t index, size_t worker) {
+            Rng rng = baseRng.Split(index);
+            m_Engines[worker]->Carve(grid, tileRegion(index), rng);
+        };
+        if (m_Pool.Size() == 1) {
+            for (size_t index = 0; index < tileCount; index++) carveTile(index, 0); // no hand-off to a single worker
+        }
+        else {
+            m_Pool.ParallelFor(tileCount, carveTile);
+        }
+
+        // Every worker's counters cover all the tiles it carved
+        MAZEGEN_STAT(m_Counters = CarveCounters());
+        MAZEGEN_STAT(for (const auto& engine : m_Engines) m_Counters.Merge(engine->Counters()));
+
+        if (tileCount == 1) return;
+
+        // 2. Random spanning tree over the tiles (Kruskal), edge = tile index * 2 + (0 right, 1 down)
+        Rng rng = baseRng.Split(~std::uint64_t(0)); // a stream no tile uses
+
+        m_Parent.resize(tileCount);
+        m_Edges.clear();
+        m_Edges.reserve(tileCount * 2);
+        for (size_t index = 0; index < tileCount; index++) {
+            m_Parent[index] = static_cast<std::uint32_t>(index);
+            int tx = static_cast<int>(index % tilesX), ty = static_cast<int>(index / tilesX);
+            if (tx + 1 < tilesX) m_Edges.push_back(static_cast<std::uint32_t>(index * 2 + 0));
+            if (ty + 1 < tilesY) m_Edges.push_back(static_cast<std::uint32_t>(index * 2 + 1));
+        }
+        rng.Shuffle(m_Edges.begin(), m_Edges.end());
+
+        auto find = [this](std::uint32_t i) {
+            while (m_Parent[i] != i) {
+                m_Parent[i] = m_Parent[m_Parent[i]];
+                i = m_Parent[i];
+            }
+            return i;
+        };
+
+        // 3. Open one random wall on the shared border of every tile pair in the tree
+        for (std::uint32_t edge : m_Edges) {
+            std::uint32_t index = edge >> 1;
+            bool down = edge & 1u;
+            std::uint32_t other = down ? index + tilesX : index + 1;
+
+            std::uint32_t a = find(index), b = find(other);
+            if (a == b) continue;
+            m_Parent[b] = a;
+            MAZEGEN_STAT(m_Counters.wallsRemoved++);
+
+            CellRegion region = tileRegion(index);
+            if (down) {
+                // Wall row below the tile, at a random cell column of the tile
+                int cx = static_cast<int>(rng.Bounded(region.cols));
+                grid.SetPassage(region.GridX(cx), region.GridY(region.rows - 1) + 1);
+            }
+            else {
+                // Wall column right of the tile, at a random cell row of the tile
+                int cy = static_cast<int>(rng.Bounded(region.rows));
+                grid.SetPassage(region.GridX(region.cols - 1) + 1, region.GridY(cy));
+            }
+        }
+    }
+
+}
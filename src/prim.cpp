@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: prim.cpp
+ * Description:
+ * Implements randomized Prim's algorithm with a compact frontier set.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "algorithm.h"
+
+namespace MazeGen {
+
+    void PrimAlgorithm::Reserve(const CellRegion& region) {
+        m_State.reserve(region.CellCount());
+        m_Frontier.reserve(region.CellCount()); // a cell is in the frontier at most once, so it never outgrows this
+    }
+
+    void PrimAlgorithm::Carve(Grid& grid, const CellRegion& region, Rng& rng) {
+        /* Randomized Prim's Algorithm
+
+            The maze grows outward from one random cell. The "frontier" holds every cell that is
+            next to the maze but not part of it yet. Each step removes a random frontier cell, connects
+            it to a random neighbour that is already in the maze, and adds its own outside neighbours
+            to the frontier.
+
+            The frontier is a plain vector of cell indices. Removing a random entry swaps it with the
+            last one and pops, so both add and remove are constant time, and m_State tells in one byte
+            per cell whether a cell is outside, in the frontier or in the maze.
+        */
+        enum : std::uint8_t { Outside = 0, Frontier = 1, InMaze = 2 };
+
+        const int cols = region.cols, rows = region.rows;
+        const size_t cellCount = region.CellCount();
+        if (cellCount == 0) return;
+
+        Reserve(region);
+        m_State.assign(cellCount, Outside);
+        m_Frontier.clear();
+
+        auto addToMaze = [&](std::uint32_t index) {
+            m_State[index] = InMaze;
+            int cx = static_cast<int>(index % cols), cy = static_cast<int>(index / cols);
+            grid.SetPassage(region.GridX(cx), region.GridY(cy));
+            MAZEGEN_STAT(m_Counters.cellsVisited++);
+
+            // Every outside neighbour becomes part of the frontier
+            auto touch = [&](std::uint32_t n) {
+                if (m_State[n] == Outside) {
+                    m_State[n] = Frontier;
+                    m_Frontier.push_back(n);
+                }
+            };
+            if (cy > 0)        touch(index - cols);
+            if (cy + 1 < rows) touch(index + cols);
+            if (cx > 0)        touch(index - 1);
+            if (cx + 1 < cols) touch(index + 1);
+            MAZEGEN_STAT(StatMax(m_Counters.maxDepth, m_Frontier.size()));
+        };
+
+        addToMaze(static_cast<std::uint32_t>(rng.Bounded64(cellCount)));
+
+        while (!m_Frontier.empty()) {
+            // Take a random cell out of the frontier (swap with the last entry, then pop)
+            size_t pick = static_cast<size_t>(rng.Bounded64(m_Frontier.size()));
+            std::uint32_t index = m_Frontier[pick];
+            m_Frontier[pick] = m_Frontier.back();
+            m_Frontier.pop_back();
+
+            int cx = static_cast<int>(index % cols), cy = static_cast<int>(index / cols);
+            int gx = region.GridX(cx), gy = region.GridY(cy);
+
+            // Collect the walls that lead to neighbours already in the maze (there is at least one)
+            int wallX[4], wallY[4], count = 0;
+            if (cy > 0 && m_State[index - cols] == InMaze)        { wallX[count] = gx;     wallY[count++] = gy - 1; }
+            if (cy + 1 < rows && m_State[index + cols] == InMaze) { wallX[count] = gx;     wallY[count++] = gy + 1; }
+            if (cx > 0 && m_State[index - 1] == InMaze)           { wallX[count] = gx - 1; wallY[count++] = gy; }
+            if (cx + 1 < cols && m_State[index + 1] == InMaze)    { wallX[count] = gx + 1; wallY[count++] = gy; }
+
+            int choice = count > 1 ? static_cast<int>(rng.Bounded(count)) : 0;
+            grid.SetPassage(wallX[choice], wallY[choice]);
+            MAZEGEN_STAT(m_Counters.steps++, m_Counters.wallsRemoved++);
+
+            addToMaze(index);
+        }
+
+        MAZEGEN_STAT(StatMax(m_Counters.scratchBytes, m_State.capacity() + m_Frontier.capacity() * sizeof(std::uint32_t)));
+    }
+
+}
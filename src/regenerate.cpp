@@ -0,0 +1,224 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: regenerate.cpp
+ * Description:
+ * Implements regional regeneration - a constrained Kruskal re-carve of the
+ * region, with skeleton pruning as the fallback.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "regenerate.h"
+
+namespace MazeGen {
+
+    // m_Old / m_New bits
+    static const std::uint8_t kRight = 1; // the wall to the right of the cell is open
+    static const std::uint8_t kDown = 2;  // the wall below the cell is open
+
+    // m_Flags bits
+    static const std::uint8_t kOpening = 1;   // the cell has an open wall to a cell outside the region
+    static const std::uint8_t kPruned = 2;    // cut off the skeleton
+    static const std::uint8_t kQueued = 4;    // waiting in m_Queue (or already pruned)
+    static const std::uint8_t kGroupRoot = 8; // root of an old tree with openings, counted in m_Groups
+
+    static const std::uint32_t kNoGroup = ~std::uint32_t(0);
+
+    void RegionRegenerator::Reserve(const CellRegion& region) {
+        const size_t cellCount = region.CellCount();
+        m_Parent.reserve(cellCount);
+        m_Label.reserve(cellCount);
+        m_Group.reserve(cellCount);
+        m_Old.reserve(cellCount);
+        m_New.reserve(cellCount);
+        m_Flags.reserve(cellCount);
+        m_Degree.reserve(cellCount);
+        m_Queue.reserve(cellCount);
+        m_Edges.reserve(cellCount * 2);
+    }
+
+    std::uint32_t RegionRegenerator::find(std::uint32_t index) {
+        while (m_Parent[index] != index) {
+            m_Parent[index] = m_Parent[m_Parent[index]]; // path halving
+            index = m_Parent[index];
+        }
+        return index;
+    }
+
+    void RegionRegenerator::Regenerate(Grid& grid, const CellRegion& region, Rng& rng) {
+        const int cols = region.cols, rows = region.rows;
+        const size_t cellCount = region.CellCount();
+        m_KeptCells = 0;
+        if (cellCount == 0) return;
+
+        const CellRegion full = CellRegion::Full(grid.Width(), grid.Height());
+
+        Reserve(region);
+        m_Old.assign(cellCount, 0);
+        m_Flags.assign(cellCount, 0);
+        m_Degree.assign(cellCount, 0);
+        m_Parent.resize(cellCount);
+
+        // 1. Read the old region - its inner passages and the cells with an opening to the outside
+        for (int cy = 0; cy < rows; cy++) {
+            const int gy = region.GridY(cy);
+            for (int cx = 0; cx < cols; cx++) {
+                const std::uint32_t index = static_cast<std::uint32_t>(cy) * cols + cx;
+                const int gx = region.GridX(cx);
+                m_Parent[index] = index;
+
+                if (cx + 1 < cols && !grid.IsWall(gx + 1, gy)) {
+                    m_Old[index] |= kRight;
+                    m_Degree[index]++;
+                    m_Degree[index + 1]++;
+                }
+                if (cy + 1 < rows && !grid.IsWall(gx, gy + 1)) {
+                    m_Old[index] |= kDown;
+                    m_Degree[index]++;
+                    m_Degree[index + cols]++;
+                }
+
+                // Only walls to real cells count - the entrance and exit in the outer border lead nowhere
+                bool opening = (cx == 0 && region.x > 0 && !grid.IsWall(gx - 1, gy))
+                    || (cx + 1 == cols && region.x + cols < full.cols && !grid.IsWall(gx + 1, gy))
+                    || (cy == 0 && region.y > 0 && !grid.IsWall(gx, gy - 1))
+                    || (cy + 1 == rows && region.y + rows < full.rows && !grid.IsWall(gx, gy + 1));
+                if (opening) m_Flags[index] |= kOpening;
+            }
+        }
+
+        // 2. The old tree of every opening (a union-find over the old passages)
+        for (std::uint32_t index = 0; index < cellCount; index++) {
+            if (m_Old[index] & kRight) m_Parent[find(index + 1)] = find(index);
+            if (m_Old[index] & kDown) m_Parent[find(index + cols)] = find(index);
+        }
+        m_Label.assign(cellCount, kNoGroup);
+        m_Groups = 0;
+        for (std::uint32_t index = 0; index < cellCount; index++) {
+            if (!(m_Flags[index] & kOpening)) continue;
+            const std::uint32_t root = find(index);
+            m_Label[index] = root;
+            if (!(m_Flags[root] & kGroupRoot)) {
+                m_Flags[root] |= kGroupRoot;
+                m_Groups++;
+            }
+        }
+
+        // 3. Carve fresh, and from the skeleton only if that cut a group in two
+        if (!carve(region, rng, false)) {
+            pruneToSkeleton(region);
+            carve(region, rng, true);
+        }
+
+        // 4. Write the new inner walls - cells and the region border stay as they are
+        for (int cy = 0; cy < rows; cy++) {
+            for (int cx = 0; cx < cols; cx++) {
+                const std::uint8_t open = m_New[static_cast<size_t>(cy) * cols + cx];
+                const int gx = region.GridX(cx), gy = region.GridY(cy);
+                if (cx + 1 < cols) (open & kRight) ? grid.SetPassage(gx + 1, gy) : grid.SetWall(gx + 1, gy);
+                if (cy + 1 < rows) (open & kDown) ? grid.SetPassage(gx, gy + 1) : grid.SetWall(gx, gy + 1);
+            }
+        }
+    }
+
+    void RegionRegenerator::pruneToSkeleton(const CellRegion& region) {
+        const int cols = region.cols;
+        const std::uint32_t cellCount = static_cast<std::uint32_t>(region.CellCount());
+
+        m_Queue.clear();
+        for (std::uint32_t index = 0; index < cellCount; index++) {
+            if (m_Degree[index] <= 1 && !(m_Flags[index] & kOpening)) {
+                m_Flags[index] |= kQueued;
+                m_Queue.push_back(index);
+            }
+        }
+
+        // Cutting off a dead end can turn its neighbour into one - every cell is queued at most once
+        for (size_t next = 0; next < m_Queue.size(); next++) {
+            const std::uint32_t index = m_Queue[next];
+            m_Flags[index] |= kPruned;
+
+            auto release = [&](std::uint32_t neighbour) {
+                if (m_Flags[neighbour] & kPruned) return;
+                m_Degree[neighbour]--;
+                if (m_Degree[neighbour] <= 1 && !(m_Flags[neighbour] & (kOpening | kQueued))) {
+                    m_Flags[neighbour] |= kQueued;
+                    m_Queue.push_back(neighbour);
+                }
+            };
+            if (m_Old[index] & kRight) release(index + 1);
+            if (m_Old[index] & kDown) release(index + cols);
+            if (index % cols > 0 && (m_Old[index - 1] & kRight)) release(index - 1);
+            if (index >= static_cast<std::uint32_t>(cols) && (m_Old[index - cols] & kDown)) release(index - cols);
+        }
+    }
+
+    bool RegionRegenerator::carve(const CellRegion& region, Rng& rng, bool skeleton) {
+        const int cols = region.cols, rows = region.rows;
+        const size_t cellCount = region.CellCount();
+
+        m_New.assign(cellCount, 0);
+        m_Group.assign(m_Label.begin(), m_Label.end()); // every cell is its own set
+        size_t groupSets = 0; // sets holding openings - the carve worked if it ends at one per group
+        for (std::uint32_t index = 0; index < cellCount; index++) {
+            m_Parent[index] = index;
+            if (m_Label[index] != kNoGroup) groupSets++;
+        }
+
+        // Joins the sets of two cells unless they hold different groups
+        auto join = [&](std::uint32_t index, std::uint32_t other) {
+            std::uint32_t a = find(index), b = find(other);
+            if (a == b) return false;
+            const std::uint32_t groupA = m_Group[a], groupB = m_Group[b];
+            if (groupA != kNoGroup && groupB != kNoGroup) {
+                if (groupA != groupB) return false;
+                groupSets--;
+            }
+            m_Parent[b] = a;
+            if (groupA == kNoGroup) m_Group[a] = groupB;
+            return true;
+        };
+
+        m_KeptCells = 0;
+        m_Edges.clear();
+        for (int cy = 0; cy < rows; cy++) {
+            for (int cx = 0; cx < cols; cx++) {
+                const std::uint32_t index = static_cast<std::uint32_t>(cy) * cols + cx;
+                const bool kept = skeleton && !(m_Flags[index] & kPruned);
+                if (kept) m_KeptCells++;
+
+                for (int dir = 0; dir < 2; dir++) {
+                    if (dir == 0 ? cx + 1 >= cols : cy + 1 >= rows) continue;
+                    const std::uint8_t bit = dir == 0 ? kRight : kDown;
+                    const std::uint32_t other = index + (dir == 0 ? 1 : cols);
+
+                    // Skeleton corridors stay open (a loop can only come from a maze that was not perfect - kept as it was)
+                    if (kept && !(m_Flags[other] & kPruned) && (m_Old[index] & bit)) {
+                        join(index, other);
+                        m_New[index] |= bit;
+                        continue;
+                    }
+                    m_Edges.push_back(index * 2 + dir);
+                }
+            }
+        }
+
+        rng.Shuffle(m_Edges.begin(), m_Edges.end());
+        for (std::uint32_t edge : m_Edges) {
+            const std::uint32_t index = edge >> 1;
+            const int dir = static_cast<int>(edge & 1u);
+            if (join(index, index + (dir == 0 ? 1 : cols))) m_New[index] |= (dir == 0 ? kRight : kDown);
+        }
+
+        return groupSets == m_Groups;
+    }
+
+}
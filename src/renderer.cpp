@@ -0,0 +1,239 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: renderer.cpp
+ * Description:
+ * Implements the buffered maze renderer.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "renderer.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>  // Used for std::memcpy() and std::strlen()
+
+#ifdef _WIN32
+#include <io.h>     // Used for _write()
+#else
+#include <unistd.h> // Used for write()
+#endif
+
+namespace MazeGen {
+
+    static const size_t kMinBuffer = 256; // enough for the longest single cell (glyph + colour codes)
+
+    // ***********************************
+    // OUTPUT BUFFER
+    // ***********************************
+
+    OutputBuffer::OutputBuffer(std::FILE* file, size_t capacity)
+        : m_File(file), m_Fd(-1), m_Data(std::max(capacity, kMinBuffer)), m_Used(0), m_Good(file != nullptr) {}
+
+    OutputBuffer::OutputBuffer(int fd, size_t capacity)
+        : m_File(nullptr), m_Fd(fd), m_Data(std::max(capacity, kMinBuffer)), m_Used(0), m_Good(fd >= 0) {}
+
+    void OutputBuffer::Append(const char* text, size_t n) {
+        // Copy in pieces no bigger than the buffer, so any length can be appended
+        while (n > 0) {
+            size_t chunk = std::min(n, m_Data.size());
+            std::memcpy(Reserve(chunk), text, chunk);
+            Commit(chunk);
+            text += chunk;
+            n -= chunk;
+        }
+    }
+
+    bool OutputBuffer::Flush() {
+        if (m_Used == 0 || !m_Good) {
+            m_Used = 0;
+            return m_Good;
+        }
+
+        if (m_File) {
+            m_Good = std::fwrite(m_Data.data(), 1, m_Used, m_File) == m_Used;
+        }
+        else {
+            // write(2) may write less than asked (pipes, signals), so keep going until everything is out
+            const char* data = m_Data.data();
+            size_t left = m_Used;
+            while (left > 0) {
+#ifdef _WIN32
+                int written = _write(m_Fd, data, static_cast<unsigned int>(std::min<size_t>(left, 1u << 30)));
+#else
+                ssize_t written = write(m_Fd, data, left);
+#endif
+                if (written < 0) {
+                    if (errno == EINTR) continue;
+                    m_Good = false;
+                    break;
+                }
+                data += written;
+                left -= static_cast<size_t>(written);
+            }
+        }
+
+        m_Used = 0;
+        return m_Good;
+    }
+
+    // ***********************************
+    // RENDERING
+    // ***********************************
+
+    static const char* const s_RenderStyleNames[] = { "ascii", "unicode" };
+
+    const char* RenderStyleName(RenderStyle style) {
+        size_t index = static_cast<size_t>(style);
+        return index < static_cast<size_t>(RenderStyle::Count) ? s_RenderStyleNames[index] : "unknown";
+    }
+
+    /* Box Drawing
+
+        A wall is drawn with the box drawing character that connects to its wall neighbours.
+        The neighbours form a 4-bit mask (1 = up, 2 = down, 4 = left, 8 = right) that indexes
+        this table. Every entry is 3 bytes of UTF-8.
+    */
+    static const char* const s_BoxGlyphs[16] = {
+        "■", // none - single wall block
+        "╵", // up
+        "╷", // down
+        "│", // up down
+        "╴", // left
+        "┘", // up left
+        "┐", // down left
+        "┤", // up down left
+        "╶", // right
+        "└", // up right
+        "┌", // down right
+        "├", // up down right
+        "─", // left right
+        "┴", // up left right
+        "┬", // down left right
+        "┼", // all four
+    };
+
+    static const char kWallColor[] = "\x1b[36m"; // cyan
+    static const char kMarkColor[] = "\x1b[33m"; // yellow
+    static const char kResetColor[] = "\x1b[0m";
+
+    static constexpr char kMark = '.';       // ASCII overlay mark
+    static const char kMarkGlyph[] = "•";    // Unicode overlay mark, 3 bytes of UTF-8
+
+    static bool marked(const RenderOptions& options, int x, int y) {
+        return options.overlay && options.overlay->IsWall(x, y);
+    }
+
+    // Replaces the characters of marked cells in an already expanded run of count cells starting at x.
+    // Goes a word at a time and skips empty words, so unmarked stretches cost almost nothing.
+    static void markRun(const Grid& overlay, int y, int x, int count, char* dst) {
+        const Grid::Word* row = overlay.Row(y);
+        const int end = x + count;
+        for (int base = x / Grid::kWordBits * Grid::kWordBits; base < end; base += Grid::kWordBits) {
+            const Grid::Word bits = row[base / Grid::kWordBits];
+            if (bits == 0) continue;
+            for (int bit = 0; bit < Grid::kWordBits; bit++) {
+                const int cx = base + bit;
+                if (((bits >> bit) & 1u) && cx >= x && cx < end) dst[cx - x] = kMark;
+            }
+        }
+    }
+    // The fast path: plain ASCII, copied 8 cells at a time through Grid's lookup table
+    static void renderAsciiRow(const Grid& grid, int y, OutputBuffer& out, const Grid* overlay) {
+        const int width = grid.Width();
+        // Largest segment that fits the buffer, kept to whole bytes so every segment but the last is aligned
+        const int segment = static_cast<int>(std::min<size_t>((out.Capacity() - 1) / 8 * 8, 1u << 20));
+
+        for (int x = 0; x < width; x += segment) {
+            int count = std::min(segment, width - x);
+            char* dst = out.Reserve(count);
+            grid.RowToChars(y, x, count, dst);
+            if (overlay) markRun(*overlay, y, x, count, dst);
+            out.Commit(count);
+        }
+        out.Put('\n');
+    }
+
+    // Cell by cell path for box drawing and/or colour
+    static void renderStyledRow(const Grid& grid, int y, OutputBuffer& out, const RenderOptions& options) {
+        const int width = grid.Width(), height = grid.Height();
+        const bool unicode = options.style == RenderStyle::Unicode;
+        const char* colour = kResetColor; // colour currently switched on
+
+        for (int x = 0; x < width; x++) {
+            char* dst = out.Reserve(16); // longest cell: colour code + 3 byte glyph
+            size_t used = 0;
+            const bool wall = grid.IsWall(x, y);
+            const bool mark = !wall && marked(options, x, y);
+
+            // Colour codes only where a run of walls or marks starts or ends, not around every cell
+            const char* wanted = wall ? kWallColor : mark ? kMarkColor : kResetColor;
+            if (options.color && wanted != colour) {
+                size_t length = std::strlen(wanted);
+                std::memcpy(dst, wanted, length);
+                used += length;
+                colour = wanted;
+            }
+
+            if (mark) {
+                if (unicode) {
+                    std::memcpy(dst + used, kMarkGlyph, 3);
+                    used += 3;
+                }
+                else {
+                    dst[used++] = kMark;
+                }
+            }
+            else if (!wall) {
+                dst[used++] = Grid::kPassage;
+            }
+            else if (!unicode) {
+                dst[used++] = Grid::kWall;
+            }
+            else {
+                int mask = 0;
+                if (y > 0 && grid.IsWall(x, y - 1))          mask |= 1;
+                if (y + 1 < height && grid.IsWall(x, y + 1)) mask |= 2;
+                if (x > 0 && grid.IsWall(x - 1, y))          mask |= 4;
+                if (x + 1 < width && grid.IsWall(x + 1, y))  mask |= 8;
+                std::memcpy(dst + used, s_BoxGlyphs[mask], 3);
+                used += 3;
+            }
+
+            out.Commit(used);
+        }
+
+        if (colour != kResetColor) out.Append(kResetColor, sizeof(kResetColor) - 1); // never leak colour into the next line
+        out.Put('\n');
+    }
+
+    bool RenderGrid(const Grid& grid, OutputBuffer& out, const RenderOptions& options) {
+        const bool plain = options.style == RenderStyle::Ascii && !options.color;
+
+        // An overlay of another size cannot line up with the maze - draw without it
+        RenderOptions checked = options;
+        if (checked.overlay && (checked.overlay->Width() != grid.Width() || checked.overlay->Height() != grid.Height())) checked.overlay = nullptr;
+
+        for (int y = 0; y < grid.Height(); y++) {
+            if (plain) renderAsciiRow(grid, y, out, checked.overlay);
+            else renderStyledRow(grid, y, out, checked);
+
+            if (!out.Good()) return false;
+        }
+        return out.Good();
+    }
+
+    bool RenderGrid(const Grid& grid, std::FILE* file, const RenderOptions& options) {
+        OutputBuffer out(file, options.bufferSize);
+        bool ok = RenderGrid(grid, out, options);
+        return out.Flush() && ok;
+    }
+
+}
@@ -0,0 +1,39 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: result.cpp
+ * Description:
+ * Implements the messages for the library error codes.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "result.h"
+
+namespace MazeGen {
+
+    const char* MazeErrorMessage(MazeError error) {
+        switch (error) {
+        case MazeError::None:         return "Success";
+        case MazeError::NoDimensions: return "Set the maze dimensions first!";
+        case MazeError::NoMaze:       return "There is no loaded or pre-made maze.\nPlease load or select \"Generate New Maze\"";
+        case MazeError::OpenFailed:   return "The file could not be opened. It may not exist or may not be writable.";
+        case MazeError::WriteFailed:  return "Writing the file failed.";
+        case MazeError::ReadFailed:   return "Reading the file failed.";
+        case MazeError::InvalidFile:  return "The file is not a maze or is damaged.";
+        case MazeError::NoSolution:   return "No path from the entrance to the exit!";
+        case MazeError::InvalidRegion: return "The region must be at least one cell and lie inside the maze.";
+        case MazeError::TooLarge: return "The maze is too large for this format.";
+        case MazeError::BadDimensions: return "The maze must be at least 3x3 with an odd width and height.";
+        }
+        return "Unknown error";
+    }
+
+}
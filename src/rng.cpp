@@ -0,0 +1,147 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: rng.cpp
+ * Description:
+ * Implements seeding for the Rng class and its engines.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "rng.h"
+#include <algorithm> // Used for std::max()
+#include <cstring>
+
+namespace MazeGen {
+
+    static const char* const s_RngKindNames[] = { "mt19937", "xoshiro" };
+
+    const char* RngKindName(RngKind kind) {
+        size_t index = static_cast<size_t>(kind);
+        return index < static_cast<size_t>(RngKind::Count) ? s_RngKindNames[index] : "unknown";
+    }
+
+    bool ParseRngKind(const char* name, RngKind& out) {
+        for (size_t i = 0; i < static_cast<size_t>(RngKind::Count); i++) {
+            if (std::strcmp(name, s_RngKindNames[i]) == 0) {
+                out = static_cast<RngKind>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // SplitMix64 - turns any 64-bit value into a well mixed one. Used to seed xoshiro and derive seeds.
+    static std::uint64_t splitMix64(std::uint64_t& state) {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    std::uint64_t DeriveSeed(std::uint64_t seed, std::uint64_t stream) {
+        std::uint64_t state = seed ^ (stream * 0xD1342543DE82EF95ull);
+        splitMix64(state);
+        return splitMix64(state);
+    }
+
+    void Xoshiro256::Seed(std::uint64_t seed) {
+        std::uint64_t state = seed;
+        for (std::uint64_t& word : m_State) word = splitMix64(state); // never all zero, SplitMix64 is a bijection
+    }
+
+    /* Two Word Seed Sequence
+
+        std::seed_seq keeps its values in a std::vector, so seeding with one allocates - once per maze
+        with a random 64-bit seed, and once per tile in tiled generation. This is the same algorithm
+        (the standard spells it out, see [rand.util.seedseq]) for exactly two values, without the
+        vector, so the Mersenne Twister gets the same state as before and seeds keep their mazes.
+    */
+    class TwoWordSeedSeq {
+    public:
+        using result_type = std::uint32_t;
+
+        TwoWordSeedSeq(std::uint32_t low, std::uint32_t high) : m_Values{ low, high } {}
+
+        size_t size() const { return 2; }
+
+        template <typename It>
+        void generate(It begin, It end) const {
+            const size_t n = static_cast<size_t>(end - begin);
+            if (n == 0) return;
+
+            auto at = [&](size_t k) -> std::uint32_t& { return begin[k % n]; };
+            auto mix = [](std::uint32_t x) { return x ^ (x >> 27); };
+
+            for (size_t k = 0; k < n; k++) begin[k] = 0x8b8b8b8bu;
+
+            const size_t s = 2;
+            const size_t t = (n >= 623) ? 11 : (n >= 68) ? 7 : (n >= 39) ? 5 : (n >= 7) ? 3 : (n - 1) / 2;
+            const size_t p = (n - t) / 2;
+            const size_t q = p + t;
+            const size_t m = std::max(s + 1, n);
+
+            for (size_t k = 0; k < m; k++) {
+                std::uint32_t r1 = 1664525u * mix(at(k) ^ at(k + p) ^ at(k + n - 1));
+                std::uint32_t r2 = r1 + static_cast<std::uint32_t>(k == 0 ? s : (k <= s ? k % n + m_Values[k - 1] : k % n));
+                at(k + p) += r1;
+                at(k + q) += r2;
+                at(k) = r2;
+            }
+            for (size_t k = m; k < m + n; k++) {
+                std::uint32_t r3 = 1566083941u * mix(at(k) + at(k + p) + at(k + n - 1));
+                std::uint32_t r4 = r3 - static_cast<std::uint32_t>(k % n);
+                at(k + p) ^= r3;
+                at(k + q) ^= r4;
+                at(k) = r4;
+            }
+        }
+
+    private:
+        std::uint32_t m_Values[2];
+    };
+
+    Rng::Rng(std::uint64_t seed, RngKind kind)
+        : m_Seed(seed), m_Kind(kind) {
+        Reset(seed, kind);
+    }
+
+    void Rng::Reset(std::uint64_t seed, RngKind kind) {
+        m_Kind = kind;
+        if (kind == RngKind::Xoshiro) {
+            if (!std::holds_alternative<Xoshiro256>(m_Engine)) m_Engine.emplace<Xoshiro256>();
+        }
+        else {
+            m_Kind = RngKind::MersenneTwister;
+            if (!std::holds_alternative<std::mt19937>(m_Engine)) m_Engine.emplace<std::mt19937>();
+        }
+        Seed(seed);
+    }
+
+    void Rng::Seed(std::uint64_t seed) {
+        m_Seed = seed;
+
+        if (m_Kind == RngKind::Xoshiro) {
+            std::get<Xoshiro256>(m_Engine).Seed(seed);
+            return;
+        }
+
+        // 32-bit seeds give exactly the sequence of std::mt19937(seed), wider seeds go through a seed sequence
+        std::mt19937& mt = std::get<std::mt19937>(m_Engine);
+        if (seed <= 0xFFFFFFFFull) {
+            mt.seed(static_cast<std::uint32_t>(seed));
+        }
+        else {
+            TwoWordSeedSeq sequence(static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32));
+            mt.seed(sequence);
+        }
+    }
+
+}
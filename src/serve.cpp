@@ -0,0 +1,924 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: serve.cpp
+ * Description:
+ * Implements the serve mode (request parsing, bounded job queue, worker
+ * threads, socket and stdin transports) and the load testing client.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "serve.h"
+#include "batch.h"       // Used for ReadNumberArg()
+#include "maze_gen.h"
+#include "maze_io.h"
+#include "result.h"
+#include "thread_pool.h" // Used for ThreadPool::HardwareThreads()
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>  // Used for _O_BINARY
+#include <io.h>     // Used for _read(), _write() and _setmode()
+#else
+#include <csignal>      // Used for stopping on SIGINT/SIGTERM and ignoring SIGPIPE
+#include <poll.h>       // Used for waiting on the listening socket with a timeout
+#include <sys/socket.h>
+#include <sys/stat.h>   // Used for checking that an old socket path really is a socket
+#include <sys/un.h>     // Used for sockaddr_un
+#include <unistd.h>     // Used for read(), write(), close() and unlink()
+#endif
+
+namespace MazeGen {
+
+    static const size_t kMaxLineLength = 64 * 1024; // longer request lines are answered with an error and skipped
+
+    /* Request Lines
+        Requests and response headers are flat JSON objects. Only what the protocol needs is parsed:
+        strings, integers, true, false and null. Nested objects, arrays and fractions are refused.
+        Unknown keys are skipped, so a newer client can send fields an older server does not know.
+    */
+    struct JsonValue {
+        enum class Type { String, Integer, Bool, Null } type = Type::Null;
+        std::string text;         // String
+        std::uint64_t number = 0; // Integer, without its sign
+        bool negative = false;    // Integer
+        bool flag = false;        // Bool
+    };
+
+    static void skipSpace(const char*& p, const char* end) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) p++;
+    }
+
+    static int hexDigit(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    // p points at the opening quote
+    static bool parseString(const char*& p, const char* end, std::string& out) {
+        out.clear();
+        p++;
+        while (p < end) {
+            char c = *p++;
+            if (c == '"') return true;
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (p >= end) return false;
+            char escaped = *p++;
+            switch (escaped) {
+            case '"': case '\\': case '/': out += escaped; break;
+            case 'n': out += '\n'; break;
+            case 't': out += '\t'; break;
+            case 'r': out += '\r'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'u': // names and algorithms are ASCII - anything above is kept as '?'
+                {
+                    if (end - p < 4) return false;
+                    unsigned code = 0;
+                    for (int i = 0; i < 4; i++) {
+                        int digit = hexDigit(p[i]);
+                        if (digit < 0) return false;
+                        code = code * 16 + static_cast<unsigned>(digit);
+                    }
+                    p += 4;
+                    out += code < 0x80 ? static_cast<char>(code) : '?';
+                }
+                break;
+            default:
+                return false;
+            }
+        }
+        return false; // no closing quote
+    }
+
+    static bool parseValue(const char*& p, const char* end, JsonValue& value) {
+        if (p >= end) return false;
+        if (*p == '"') {
+            value.type = JsonValue::Type::String;
+            return parseString(p, end, value.text);
+        }
+
+        auto literal = [&](const char* word) {
+            const size_t length = std::strlen(word);
+            if (static_cast<size_t>(end - p) < length || std::memcmp(p, word, length) != 0) return false;
+            p += length;
+            return true;
+        };
+        if (literal("true")) {
+            value.type = JsonValue::Type::Bool;
+            value.flag = true;
+            return true;
+        }
+        if (literal("false")) {
+            value.type = JsonValue::Type::Bool;
+            value.flag = false;
+            return true;
+        }
+        if (literal("null")) {
+            value.type = JsonValue::Type::Null;
+            return true;
+        }
+
+        value.type = JsonValue::Type::Integer;
+        value.negative = *p == '-';
+        if (value.negative) p++;
+        if (p >= end || *p < '0' || *p > '9') return false;
+        value.number = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            const unsigned digit = static_cast<unsigned>(*p - '0');
+            if (value.number > (~std::uint64_t(0) - digit) / 10) return false; // does not fit 64 bits
+            value.number = value.number * 10 + digit;
+            p++;
+        }
+        return p >= end || (*p != '.' && *p != 'e' && *p != 'E'); // integers only
+    }
+
+    // Parses one flat object and calls field(key, value) for every member. Returns false with error set on bad syntax.
+    template <typename Field>
+    static bool parseObject(const char* p, const char* end, const Field& field, std::string& error) {
+        std::string key;
+        JsonValue value;
+
+        skipSpace(p, end);
+        if (p >= end || *p != '{') {
+            error = "expected a JSON object";
+            return false;
+        }
+        p++;
+        skipSpace(p, end);
+
+        if (p < end && *p == '}') {
+            p++;
+        }
+        else {
+            for (;;) {
+                skipSpace(p, end);
+                if (p >= end || *p != '"' || !parseString(p, end, key)) {
+                    error = "expected a quoted key";
+                    return false;
+                }
+                skipSpace(p, end);
+                if (p >= end || *p != ':') {
+                    error = "expected ':' after \"" + key + "\"";
+                    return false;
+                }
+                p++;
+                skipSpace(p, end);
+                if (!parseValue(p, end, value)) {
+                    error = "bad value for \"" + key + "\" (expected a string, an integer, true, false or null)";
+                    return false;
+                }
+                field(key, value);
+
+                skipSpace(p, end);
+                if (p < end && *p == ',') {
+                    p++;
+                    continue;
+                }
+                if (p < end && *p == '}') {
+                    p++;
+                    break;
+                }
+                error = "expected ',' or '}' after \"" + key + "\"";
+                return false;
+            }
+        }
+
+        skipSpace(p, end);
+        if (p != end) {
+            error = "unexpected characters after the object";
+            return false;
+        }
+        return true;
+    }
+
+    // Appends text as a JSON string, quotes included
+    static void appendJsonString(std::string& out, const std::string& text) {
+        out += '"';
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                out += escaped;
+            }
+            else {
+                out += c;
+            }
+        }
+        out += '"';
+    }
+
+    /* File Descriptors
+        The transports are plain file descriptors - a socket, or stdin and stdout - so both are read
+        and written the same way, without the buffering of the C++ streams in between.
+    */
+    static long readSome(int fd, char* buffer, size_t size) {
+        for (;;) {
+#ifdef _WIN32
+            long got = _read(fd, buffer, static_cast<unsigned>(std::min<size_t>(size, 1u << 30)));
+#else
+            long got = static_cast<long>(::read(fd, buffer, size));
+            if (got < 0 && errno == EINTR) continue;
+#endif
+            return got;
+        }
+    }
+
+    static bool writeAll(int fd, const void* data, size_t size) {
+        const char* bytes = static_cast<const char*>(data);
+        while (size > 0) {
+#ifdef _WIN32
+            long written = _write(fd, bytes, static_cast<unsigned>(std::min<size_t>(size, 1u << 30)));
+#else
+            long written = static_cast<long>(::write(fd, bytes, size));
+            if (written < 0 && errno == EINTR) continue;
+#endif
+            if (written <= 0) return false;
+            bytes += written;
+            size -= static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+    struct ServeRequest {
+        std::uint64_t id = 0;
+        int width = 15, height = 9;
+        std::uint64_t seed = 0;
+        bool hasSeed = false;
+        Algorithm algorithm = Algorithm::Backtracker;
+        RngKind rng = RngKind::MersenneTwister;
+        bool compress = false;
+        bool legacy = false;
+        std::string name = "maze";
+        std::string error; // set when the request is invalid - it is answered without generating
+    };
+
+    // One client: a socket, or stdin and stdout. Shared by its reader and the jobs still running for it.
+    struct Connection {
+        Connection(int input, int output, bool ownsSocket) : input(input), output(output), ownsSocket(ownsSocket) {}
+        ~Connection() {
+#ifndef _WIN32
+            if (ownsSocket) ::close(input); // the last response is out - the client sees the end of the stream
+#endif
+        }
+
+        int input, output;
+        bool ownsSocket;
+        std::mutex writeMutex; // one response at a time, so frames never interleave
+        bool broken = false;   // a write failed - the client is gone and later responses are dropped
+    };
+
+    struct ServeJob {
+        std::shared_ptr<Connection> connection;
+        ServeRequest request;
+        std::chrono::steady_clock::time_point received;
+    };
+
+    /* Job Queue
+        A fixed ring of slots. Push blocks while every slot is taken, which is the backpressure: the
+        reader that pushes stops reading its connection. Pop blocks while the queue is empty and
+        returns false once it is closed and drained, which is how the workers finish.
+    */
+    class JobQueue {
+    public:
+        explicit JobQueue(size_t capacity) : m_Jobs(std::max<size_t>(capacity, 1)) {}
+
+        void Push(ServeJob&& job) {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_NotFull.wait(lock, [&] { return m_Count < m_Jobs.size() || m_Closed; });
+            if (m_Closed) return;
+            m_Jobs[(m_Head + m_Count) % m_Jobs.size()] = std::move(job);
+            m_Count++;
+            lock.unlock();
+            m_NotEmpty.notify_one();
+        }
+
+        bool Pop(ServeJob& job) {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_NotEmpty.wait(lock, [&] { return m_Count > 0 || m_Closed; });
+            if (m_Count == 0) return false;
+            job = std::move(m_Jobs[m_Head]); // leaves the slot without a connection reference
+            m_Head = (m_Head + 1) % m_Jobs.size();
+            m_Count--;
+            lock.unlock();
+            m_NotFull.notify_one();
+            return true;
+        }
+
+        void Close() {
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Closed = true;
+            }
+            m_NotFull.notify_all();
+            m_NotEmpty.notify_all();
+        }
+
+    private:
+        std::vector<ServeJob> m_Jobs;
+        size_t m_Head = 0, m_Count = 0;
+        bool m_Closed = false;
+        std::mutex m_Mutex;
+        std::condition_variable m_NotFull, m_NotEmpty;
+    };
+
+    // Everything the readers and workers of one server share
+    struct ServeContext {
+        explicit ServeContext(const ServeOptions& options) : options(options), queue(options.queueSize) {}
+
+        const ServeOptions& options;
+        JobQueue queue;
+        std::uint64_t randomSeed = 0;               // base for the seeds of requests without one
+        std::atomic<std::uint64_t> randomCount{ 0 };
+        std::atomic<std::uint64_t> served{ 0 }, failed{ 0 };
+    };
+
+    static void parseRequest(const char* begin, const char* end, std::uint64_t lineNumber, const ServeOptions& options,
+                             ServeRequest& request) {
+        request.id = lineNumber;
+
+        // Field errors are remembered and parsing goes on, so the answer still carries the request's id
+        auto fail = [&](const std::string& message) {
+            if (request.error.empty()) request.error = message;
+        };
+        auto field = [&](const std::string& key, const JsonValue& value) {
+            const bool isInteger = value.type == JsonValue::Type::Integer;
+            if (key == "id") {
+                if (!isInteger || value.negative) fail("\"id\" must be a non-negative integer");
+                else request.id = value.number;
+            }
+            else if (key == "width" || key == "height") {
+                if (!isInteger || value.negative || value.number < 3 || value.number > static_cast<std::uint64_t>(options.maxSide)) {
+                    fail("\"" + key + "\" must be between 3 and " + std::to_string(options.maxSide));
+                }
+                else {
+                    (key == "width" ? request.width : request.height) = static_cast<int>(value.number);
+                }
+            }
+            else if (key == "seed") {
+                if (value.type == JsonValue::Type::Null) return; // same as no seed
+                if (!isInteger) {
+                    fail("\"seed\" must be an integer");
+                    return;
+                }
+                request.seed = value.negative ? 0 - value.number : value.number; // negative seeds wrap like on the command line
+                request.hasSeed = true;
+            }
+            else if (key == "algorithm") {
+                if (value.type != JsonValue::Type::String || !ParseAlgorithm(value.text, request.algorithm)) {
+                    fail("unknown algorithm '" + value.text + "' (backtracker, eller, kruskal, prim or wilson)");
+                }
+            }
+            else if (key == "rng") {
+                if (value.type != JsonValue::Type::String || !ParseRngKind(value.text.c_str(), request.rng)) {
+                    fail("unknown rng '" + value.text + "' (mt19937 or xoshiro)");
+                }
+            }
+            else if (key == "compress") {
+                if (value.type != JsonValue::Type::Bool) fail("\"compress\" must be true or false");
+                request.compress = value.flag;
+            }
+            else if (key == "format") {
+                if (value.type == JsonValue::Type::String && (value.text == "binary" || value.text == "legacy")) {
+                    request.legacy = value.text == "legacy";
+                }
+                else {
+                    fail("unknown format '" + value.text + "' (binary or legacy)");
+                }
+            }
+            else if (key == "name") {
+                if (value.type != JsonValue::Type::String) fail("\"name\" must be a string");
+                else request.name = value.text;
+            }
+        };
+
+        std::string error;
+        if (!parseObject(begin, end, field, error)) fail(error);
+    }
+
+    static void sendResponse(Connection& connection, const std::vector<std::uint8_t>& frame) {
+        std::lock_guard<std::mutex> lock(connection.writeMutex);
+        if (connection.broken) return;
+        if (!writeAll(connection.output, frame.data(), frame.size())) connection.broken = true;
+    }
+
+    static void serveWorker(ServeContext& context) {
+        // Kept for the whole run - after the first request of a size nothing is allocated for the maze
+        MazeGenerator generator;
+        std::vector<std::uint8_t> payload;
+        std::vector<std::uint8_t> frame; // header line and payload, sent with one write
+        std::string header;
+        std::ostringstream legacy;
+        ServeJob job;
+
+        while (context.queue.Pop(job)) {
+            ServeRequest& request = job.request;
+            payload.clear();
+
+            std::uint64_t seed = request.seed;
+            if (request.error.empty()) {
+                if (!request.hasSeed) seed = DeriveSeed(context.randomSeed, context.randomCount++);
+                generator.SetDimensions(request.width, request.height, false);
+                generator.SetAlgorithm(request.algorithm);
+                if (generator.GetRngKind() != request.rng) generator.SetRngKind(request.rng); // reseeding a Mersenne Twister is not free
+
+                MazeError result = generator.GenerateSeeded(seed);
+                if (result != MazeError::None) request.error = MazeErrorMessage(result);
+            }
+
+            if (request.error.empty()) {
+                const Maze& maze = generator.GetMaze();
+                generator.SetMazeName(request.name);
+                if (request.legacy) {
+                    legacy.str(std::string());
+                    WriteLegacyMaze(legacy, maze);
+                    const std::string bytes = legacy.str();
+                    payload.assign(bytes.begin(), bytes.end());
+                }
+                else {
+                    EncodeMaze(maze, payload, request.compress);
+                }
+
+                const long long micros = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - job.received).count();
+                char line[320];
+                std::snprintf(line, sizeof(line),
+                    "{\"id\":%llu,\"ok\":true,\"width\":%d,\"height\":%d,\"seed\":%llu,\"algorithm\":\"%s\",\"format\":\"%s\",\"size\":%zu,\"micros\":%lld}\n",
+                    static_cast<unsigned long long>(request.id), maze.m_Width, maze.m_Height, static_cast<unsigned long long>(seed),
+                    AlgorithmName(request.algorithm), request.legacy ? "legacy" : "binary", payload.size(), micros);
+                header = line;
+                context.served++;
+            }
+            else {
+                header = "{\"id\":" + std::to_string(request.id) + ",\"ok\":false,\"error\":";
+                appendJsonString(header, request.error);
+                header += "}\n";
+                context.failed++;
+            }
+
+            frame.assign(header.begin(), header.end());
+            frame.insert(frame.end(), payload.begin(), payload.end());
+            sendResponse(*job.connection, frame);
+            job.connection.reset(); // the last job of a closed connection closes its socket
+        }
+    }
+
+    // Reads request lines from one connection into the queue until the connection ends
+    static void readRequests(const std::shared_ptr<Connection>& connection, ServeContext& context) {
+        std::string buffer;
+        std::vector<char> chunk(64 * 1024);
+        std::uint64_t lineNumber = 0;
+        bool skipping = false; // inside a line that was too long, up to its newline
+
+        auto handleLine = [&](const char* begin, const char* end) {
+            lineNumber++;
+            const char* first = begin;
+            skipSpace(first, end);
+            if (first == end) return; // blank lines are allowed between requests
+
+            ServeJob job;
+            job.connection = connection;
+            job.received = std::chrono::steady_clock::now();
+            parseRequest(first, end, lineNumber, context.options, job.request);
+            context.queue.Push(std::move(job)); // blocks while the queue is full
+        };
+
+        for (;;) {
+            const long got = readSome(connection->input, chunk.data(), chunk.size());
+            if (got <= 0) break;
+
+            const char* data = chunk.data();
+            const char* end = data + got;
+            while (data < end) {
+                const char* newline = static_cast<const char*>(std::memchr(data, '\n', end - data));
+                const char* stop = newline ? newline : end;
+
+                if (!skipping) buffer.append(data, stop);
+                if (buffer.size() > kMaxLineLength) {
+                    // Answered with the line number as id and skipped up to its newline
+                    ServeJob job;
+                    job.connection = connection;
+                    job.received = std::chrono::steady_clock::now();
+                    job.request.id = ++lineNumber;
+                    job.request.error = "request line longer than " + std::to_string(kMaxLineLength) + " bytes";
+                    context.queue.Push(std::move(job));
+                    buffer.clear();
+                    skipping = true;
+                }
+
+                if (!newline) break;
+                if (!skipping) handleLine(buffer.data(), buffer.data() + buffer.size());
+                buffer.clear();
+                skipping = false;
+                data = newline + 1;
+            }
+        }
+
+        if (!skipping && !buffer.empty()) handleLine(buffer.data(), buffer.data() + buffer.size()); // last line without a newline
+    }
+
+    static int serveStdio(ServeContext& context) {
+#ifdef _WIN32
+        _setmode(_fileno(stdin), _O_BINARY); // records are binary - no newline translation
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        std::cerr << "Serving on stdin/stdout with " << context.options.threads << " worker(s)\n";
+        readRequests(std::make_shared<Connection>(0, 1, false), context);
+        return 0;
+    }
+
+#ifdef _WIN32
+
+    static int serveSocket(ServeContext&) {
+        std::cerr << "Error: --socket needs Unix domain sockets, which this build does not have - serve on stdin instead\n";
+        return 1;
+    }
+
+#else
+
+    static volatile std::sig_atomic_t g_StopServing = 0;
+
+    static void onStopSignal(int) {
+        g_StopServing = 1;
+    }
+
+    static bool socketAddress(const std::string& path, sockaddr_un& address) {
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(address.sun_path)) return false;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+
+    // A connection and the thread reading it
+    struct ServeSession {
+        std::thread reader;
+        std::weak_ptr<Connection> connection; // weak - the socket closes with the last response, not with the session
+        std::atomic<bool> done{ false };
+    };
+
+    static int serveSocket(ServeContext& context) {
+        const std::string& path = context.options.socketPath;
+        sockaddr_un address;
+        if (!socketAddress(path, address)) {
+            std::cerr << "Error: socket path '" << path << "' is too long\n";
+            return 1;
+        }
+
+        // A socket left behind by a server that did not shut down cleanly - never remove anything else
+        struct stat info;
+        if (::stat(path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) ::unlink(path.c_str());
+
+        int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0 || ::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+            || ::listen(listener, 128) != 0) {
+            std::cerr << "Error: cannot listen on " << path << ": " << std::strerror(errno) << '\n';
+            if (listener >= 0) ::close(listener);
+            return 1;
+        }
+
+        g_StopServing = 0;
+        std::signal(SIGINT, onStopSignal);
+        std::signal(SIGTERM, onStopSignal);
+        std::cerr << "Serving on " << path << " with " << context.options.threads << " worker(s) - Ctrl+C to stop\n";
+
+        std::list<ServeSession> sessions; // a list, so a session never moves while its reader runs
+        while (!g_StopServing) {
+            // Wakes up now and then to notice the stop signal, which may be delivered to another thread
+            pollfd waiting{ listener, POLLIN, 0 };
+            const int ready = ::poll(&waiting, 1, 200);
+
+            for (auto session = sessions.begin(); session != sessions.end();) {
+                if (session->done) {
+                    session->reader.join();
+                    session = sessions.erase(session);
+                }
+                else {
+                    ++session;
+                }
+            }
+            if (ready <= 0) continue;
+
+            const int client = ::accept(listener, nullptr, nullptr);
+            if (client < 0) continue;
+
+            auto connection = std::make_shared<Connection>(client, client, true);
+            sessions.emplace_back();
+            ServeSession& session = sessions.back();
+            session.connection = connection;
+            session.reader = std::thread([&context, &session, connection]() mutable {
+                readRequests(connection, context);
+                connection.reset();
+                session.done = true;
+            });
+        }
+
+        // Stop reading, answer everything that was read
+        ::close(listener);
+        ::unlink(path.c_str());
+        for (ServeSession& session : sessions) {
+            if (std::shared_ptr<Connection> connection = session.connection.lock()) ::shutdown(connection->input, SHUT_RD);
+        }
+        for (ServeSession& session : sessions) session.reader.join();
+        return 0;
+    }
+
+#endif
+
+    bool ParseServeArgs(int argc, char* argv[], int first, ServeOptions& options, std::string& error) {
+        for (int i = first; i < argc; i++) {
+            std::string arg = argv[i];
+            long long value = 0;
+
+            if (arg == "--socket") {
+                if (i + 1 >= argc) { error = "missing path after --socket"; return false; }
+                options.socketPath = argv[++i];
+            }
+            else if (arg == "--threads") {
+                if (!ReadNumberArg(argc, argv, i, value, error)) return false;
+                if (value < 0) { error = "--threads cannot be negative"; return false; }
+                options.threads = static_cast<int>(value);
+            }
+            else if (arg == "--queue") {
+                if (!ReadNumberArg(argc, argv, i, value, error)) return false;
+                if (value <= 0) { error = "--queue must be positive"; return false; }
+                options.queueSize = static_cast<size_t>(value);
+            }
+            else if (arg == "--max-side") {
+                if (!ReadNumberArg(argc, argv, i, value, error)) return false;
+                if (value < 3 || value > 1000000) { error = "--max-side must be between 3 and 1000000"; return false; }
+                options.maxSide = static_cast<int>(value);
+            }
+            else {
+                error = "unknown option '" + arg + "'";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int RunServe(const ServeOptions& requested) {
+        ServeOptions options = requested;
+        if (options.threads <= 0) options.threads = static_cast<int>(ThreadPool::HardwareThreads());
+
+#ifndef _WIN32
+        std::signal(SIGPIPE, SIG_IGN); // a client that hangs up fails the write instead of killing the server
+#endif
+
+        ServeContext context(options);
+        std::random_device device;
+        context.randomSeed = (static_cast<std::uint64_t>(device()) << 32) | device();
+
+        std::vector<std::thread> workers;
+        for (int i = 0; i < options.threads; i++) workers.emplace_back(serveWorker, std::ref(context));
+
+        auto start = std::chrono::steady_clock::now();
+        const int exitCode = options.socketPath.empty() ? serveStdio(context) : serveSocket(context);
+
+        // Readers are done - the workers answer what is still queued, then stop
+        context.queue.Close();
+        for (std::thread& worker : workers) worker.join();
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cerr << "Served " << context.served << " maze(s), " << context.failed << " failed request(s) in " << seconds << "s\n";
+        return exitCode;
+    }
+
+    /* Client
+        One thread sends the requests, never more than --inflight ahead of the responses, while the
+        calling thread reads the responses, checks that every record decodes to a maze of the
+        requested size and records the latency of each request.
+    */
+    bool ParseClientArgs(int argc, char* argv[], int first, ClientOptions& options, std::string& error) {
+        for (int i = first; i < argc; i++) {
+            std::string arg = argv[i];
+            long long value = 0;
+
+            if (arg == "--socket") {
+                if (i + 1 >= argc) { error = "missing path after --socket"; return false; }
+                options.socketPath = argv[++i];
+            }
+            else if (arg == "--count" || arg == "--inflight") {
+                if (!ReadNumberArg(argc, argv, i, value, error)) return false;
+                if (value <= 0) { error = arg + " must be positive"; return false; }
+                (arg == "--count" ? options.count : options.inflight) = static_cast<size_t>(value);
+            }
+            else if (arg == "--width" || arg == "--height") {
+                if (!ReadNumberArg(argc, argv, i, value, error)) return false;
+                if (value < 3 || value > 1000000) { error = arg + " must be between 3 and 1000000"; return false; }
+                (arg == "--width" ? options.width : options.height) = static_cast<int>(value);
+            }
+            else if (arg == "--seed") {
+                if (!ReadNumberArg(argc, argv, i, value, error)) return false;
+                options.seed = static_cast<std::uint64_t>(value);
+            }
+            else if (arg == "--algorithm") {
+                if (i + 1 >= argc || !ParseAlgorithm(argv[i + 1], options.algorithm)) {
+                    error = "--algorithm expects one of: backtracker, eller, kruskal, prim, wilson";
+                    return false;
+                }
+                i++;
+            }
+            else if (arg == "--rng") {
+                if (i + 1 >= argc || !ParseRngKind(argv[i + 1], options.rng)) {
+                    error = "--rng expects mt19937 or xoshiro";
+                    return false;
+                }
+                i++;
+            }
+            else if (arg == "--compress") {
+                options.compress = true;
+            }
+            else {
+                error = "unknown option '" + arg + "'";
+                return false;
+            }
+        }
+        if (options.socketPath.empty()) {
+            error = "client needs --socket";
+            return false;
+        }
+        return true;
+    }
+
+#ifdef _WIN32
+
+    int RunClient(const ClientOptions&) {
+        std::cerr << "Error: the client needs Unix domain sockets, which this build does not have\n";
+        return 1;
+    }
+
+#else
+
+    int RunClient(const ClientOptions& options) {
+        sockaddr_un address;
+        if (!socketAddress(options.socketPath, address)) {
+            std::cerr << "Error: socket path '" << options.socketPath << "' is too long\n";
+            return 1;
+        }
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            std::cerr << "Error: cannot connect to " << options.socketPath << ": " << std::strerror(errno) << '\n';
+            if (fd >= 0) ::close(fd);
+            return 1;
+        }
+        std::signal(SIGPIPE, SIG_IGN);
+
+        using Clock = std::chrono::steady_clock;
+        std::vector<Clock::time_point> sent(options.count);
+        std::vector<double> latencies; // microseconds
+        latencies.reserve(options.count);
+
+        std::mutex mutex;
+        std::condition_variable slotFree;
+        size_t outstanding = 0;
+        bool stopSending = false;
+
+        auto start = Clock::now();
+        std::thread sender([&] {
+            char line[320];
+            for (size_t i = 0; i < options.count; i++) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    slotFree.wait(lock, [&] { return outstanding < options.inflight || stopSending; });
+                    if (stopSending) break;
+                    outstanding++;
+                    sent[i] = Clock::now();
+                }
+                const int length = std::snprintf(line, sizeof(line),
+                    "{\"id\":%zu,\"width\":%d,\"height\":%d,\"seed\":%llu,\"algorithm\":\"%s\",\"rng\":\"%s\",\"compress\":%s}\n",
+                    i, options.width, options.height, static_cast<unsigned long long>(DeriveSeed(options.seed, i)),
+                    AlgorithmName(options.algorithm), RngKindName(options.rng), options.compress ? "true" : "false");
+                if (!writeAll(fd, line, static_cast<size_t>(length))) break;
+            }
+            ::shutdown(fd, SHUT_WR); // no more requests - the server closes the socket after the last response
+        });
+
+        // Responses: a header line, then "size" bytes of record
+        std::vector<char> input(64 * 1024);
+        size_t begin = 0, end = 0;
+        auto fill = [&]() {
+            if (begin > 0) {
+                std::memmove(input.data(), input.data() + begin, end - begin);
+                end -= begin;
+                begin = 0;
+            }
+            if (end == input.size()) input.resize(input.size() * 2);
+            const long got = readSome(fd, input.data() + end, input.size() - end);
+            if (got <= 0) return false;
+            end += static_cast<size_t>(got);
+            return true;
+        };
+
+        size_t received = 0, failures = 0;
+        std::string firstError;
+        Maze maze;
+        while (received < options.count) {
+            const char* newline = nullptr;
+            while (!(newline = static_cast<const char*>(std::memchr(input.data() + begin, '\n', end - begin)))) {
+                if (!fill()) break;
+            }
+            if (!newline) break; // the server closed the connection early
+
+            std::uint64_t id = ~std::uint64_t(0), size = 0;
+            bool ok = false;
+            std::string message, error;
+            auto field = [&](const std::string& key, const JsonValue& value) {
+                if (key == "id") id = value.number;
+                else if (key == "ok") ok = value.flag;
+                else if (key == "size") size = value.number;
+                else if (key == "error") message = value.text;
+            };
+            const bool parsed = parseObject(input.data() + begin, newline, field, error);
+            begin = static_cast<size_t>(newline - input.data()) + 1;
+            if (!parsed || id >= options.count) {
+                std::cerr << "Error: bad response header" << (error.empty() ? "" : ": " + error) << '\n';
+                break;
+            }
+
+            bool good = ok;
+            if (ok) {
+                while (end - begin < size) {
+                    if (!fill()) break;
+                }
+                if (end - begin < size) break;
+                const std::uint8_t* record = reinterpret_cast<const std::uint8_t*>(input.data() + begin);
+                const int expectedWidth = options.width | 1, expectedHeight = options.height | 1; // rounded up to odd like SetDimensions
+                good = DecodeMaze(record, size, maze) == size && maze.m_Width == expectedWidth && maze.m_Height == expectedHeight;
+                if (!good) message = "record does not decode to a " + std::to_string(expectedWidth) + "x" + std::to_string(expectedHeight) + " maze";
+                begin += size;
+            }
+            if (!good) {
+                failures++;
+                if (firstError.empty()) firstError = message;
+            }
+
+            received++;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - sent[id]).count());
+                outstanding--;
+            }
+            slotFree.notify_one();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopSending = true;
+        }
+        slotFree.notify_one();
+        sender.join();
+        ::close(fd);
+
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&](double p) {
+            return latencies.empty() ? 0.0 : latencies[std::min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()))];
+        };
+        double total = 0;
+        for (double latency : latencies) total += latency;
+
+        std::cout << "Received " << received << " of " << options.count << " " << (options.width | 1) << "x" << (options.height | 1) << " "
+            << AlgorithmName(options.algorithm) << " mazes in " << seconds << "s - " << (seconds > 0 ? received / seconds : 0.0)
+            << " mazes/s with " << options.inflight << " in flight\n";
+        std::cout << "Latency (us): mean " << (latencies.empty() ? 0.0 : total / latencies.size()) << ", p50 " << percentile(0.50)
+            << ", p99 " << percentile(0.99) << ", max " << (latencies.empty() ? 0.0 : latencies.back()) << '\n';
+
+        if (failures > 0) std::cerr << failures << " request(s) failed: " << firstError << '\n';
+        return (failures > 0 || received < options.count) ? 1 : 0;
+    }
+
+#endif
+
+}
@@ -0,0 +1,500 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: solver.cpp
+ * Description:
+ * Implements the maze solvers and the solution overlay.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "solver.h"
+#include <algorithm> // Used for std::reverse() and std::max()
+#include <chrono>    // Used for timing each solve
+#include <limits>
+
+namespace MazeGen {
+
+    static const char* const s_SolveMethodNames[] = { "bfs", "astar", "bidirectional", "deadend" };
+
+    const char* SolveMethodName(SolveMethod method) {
+        size_t index = static_cast<size_t>(method);
+        return index < static_cast<size_t>(SolveMethod::Count) ? s_SolveMethodNames[index] : "unknown";
+    }
+
+    bool ParseSolveMethod(const std::string& name, SolveMethod& out) {
+        for (size_t i = 0; i < static_cast<size_t>(SolveMethod::Count); i++) {
+            if (name == s_SolveMethodNames[i]) {
+                out = static_cast<SolveMethod>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // ***********************************
+    // CELL GRAPH
+    // ***********************************
+
+    // Directions: 0 = up, 1 = down, 2 = left, 3 = right. The opposite direction is d ^ 1.
+    static constexpr int kUp = 0, kDown = 1, kLeft = 2, kRight = 3;
+
+    /* Cell View
+
+        Reads the packed grid as a graph of cells. Two cells are connected when the grid position
+        between them is a passage (and so is the cell being moved to). Every test is one shift and
+        mask on a word of the grid - nothing is copied out of it first.
+    */
+    struct CellView {
+        const Grid::Word* data;
+        size_t wordsPerRow;
+        int cols, rows;
+
+        explicit CellView(const Grid& grid)
+            : data(grid.Data()), wordsPerRow(grid.WordsPerRow()),
+              cols((grid.Width() - 1) / 2), rows((grid.Height() - 1) / 2) {}
+
+        bool Wall(int x, int y) const {
+            return (data[static_cast<size_t>(y) * wordsPerRow + static_cast<size_t>(x / Grid::kWordBits)] >> (x % Grid::kWordBits)) & 1u;
+        }
+
+        // True if cell (cx, cy) can move one cell in direction dir
+        bool Open(int cx, int cy, int dir) const {
+            const int gx = 2 * cx + 1, gy = 2 * cy + 1;
+            switch (dir) {
+            case kUp:    return cy > 0 && !Wall(gx, gy - 1) && !Wall(gx, gy - 2);
+            case kDown:  return cy + 1 < rows && !Wall(gx, gy + 1) && !Wall(gx, gy + 2);
+            case kLeft:  return cx > 0 && !Wall(gx - 1, gy) && !Wall(gx - 2, gy);
+            default:     return cx + 1 < cols && !Wall(gx + 1, gy) && !Wall(gx + 2, gy);
+            }
+        }
+
+        std::uint32_t Step(std::uint32_t cell, int dir) const {
+            switch (dir) {
+            case kUp:    return cell - static_cast<std::uint32_t>(cols);
+            case kDown:  return cell + static_cast<std::uint32_t>(cols);
+            case kLeft:  return cell - 1;
+            default:     return cell + 1;
+            }
+        }
+    };
+
+    static bool testBit(const std::vector<Grid::Word>& bits, std::uint32_t i) { return (bits[i / 64] >> (i % 64)) & 1u; }
+    static void setBit(std::vector<Grid::Word>& bits, std::uint32_t i) { bits[i / 64] |= Grid::Word(1) << (i % 64); }
+
+    static void clearBits(std::vector<Grid::Word>& bits, size_t count) {
+        bits.assign((count + 63) / 64, 0); // keeps the capacity, so repeated solves do not allocate
+    }
+
+    // Finds the entrance and exit openings in the outer wall and the cells just inside them
+    static bool findEnds(const Grid& grid, const CellView& view, Solution& out, std::uint32_t& start, std::uint32_t& goal) {
+        const int w = grid.Width(), h = grid.Height();
+
+        // Border openings next to a cell, in scan order: top row, left column, right column, bottom row
+        struct Opening { int x, y, cx, cy; };
+        auto opening = [&](int i, Opening& o) {
+            const int across = view.cols, down = view.rows;
+            if (i < across)                { o = { 2 * i + 1, 0, i, 0 }; }
+            else if ((i -= across) < down) { o = { 0, 2 * i + 1, 0, i }; }
+            else if ((i -= down) < down)   { o = { w - 1, 2 * i + 1, view.cols - 1, i }; }
+            else { i -= down;                o = { 2 * i + 1, h - 1, i, view.rows - 1 }; }
+            return !view.Wall(o.x, o.y);
+        };
+
+        const int total = 2 * (view.cols + view.rows);
+        Opening first{}, last{};
+        int firstIndex = -1, lastIndex = -1;
+        for (int i = 0; i < total && firstIndex < 0; i++) if (opening(i, first)) firstIndex = i;
+        for (int i = total - 1; i > firstIndex && lastIndex < 0; i--) if (opening(i, last)) lastIndex = i;
+        if (firstIndex < 0 || lastIndex < 0) return false;
+
+        out.startX = first.x; out.startY = first.y;
+        out.goalX = last.x; out.goalY = last.y;
+        start = static_cast<std::uint32_t>(first.cy) * static_cast<std::uint32_t>(view.cols) + static_cast<std::uint32_t>(first.cx);
+        goal = static_cast<std::uint32_t>(last.cy) * static_cast<std::uint32_t>(view.cols) + static_cast<std::uint32_t>(last.cx);
+
+        // The cells behind the openings have to be open too, otherwise nothing connects to them
+        return !view.Wall(2 * first.cx + 1, 2 * first.cy + 1) && !view.Wall(2 * last.cx + 1, 2 * last.cy + 1);
+    }
+
+    // Follows the direction bytes from cell back to start and appends the cells to path, start first
+    static void tracePath(const CellView& view, const std::vector<std::uint8_t>& from, std::uint32_t cell,
+                          std::uint32_t start, std::vector<std::uint32_t>& path) {
+        const size_t first = path.size();
+        for (; cell != start; cell = view.Step(cell, from[cell] ^ 1)) path.push_back(cell);
+        path.push_back(start);
+        std::reverse(path.begin() + static_cast<std::ptrdiff_t>(first), path.end());
+    }
+
+    // ***********************************
+    // SOLVER
+    // ***********************************
+
+    void Solver::CellQueue::Push(std::uint32_t cell) {
+        if (count == items.size()) {
+            // Full - unroll the ring into a buffer twice the size
+            std::vector<std::uint32_t> bigger(items.size() * 2);
+            for (size_t i = 0; i < count; i++) bigger[i] = items[(head + i) & (items.size() - 1)];
+            items.swap(bigger);
+            head = 0;
+        }
+        items[(head + count++) & (items.size() - 1)] = cell; // the size is always a power of two
+    }
+
+    std::uint32_t Solver::CellQueue::Pop() {
+        std::uint32_t cell = items[head];
+        head = (head + 1) & (items.size() - 1);
+        count--;
+        return cell;
+    }
+
+    bool Solver::Solve(const Grid& grid, SolveMethod method, Solution& out) {
+        auto begin = std::chrono::steady_clock::now();
+
+        out.solved = false;
+        out.path.clear();
+        out.stats = SolveStats();
+        out.width = grid.Width();
+        out.height = grid.Height();
+        out.cols = (grid.Width() - 1) / 2;
+        out.rows = (grid.Height() - 1) / 2;
+
+        // Cells on odd coordinates need odd dimensions, and cell indices have to fit in 32 bits
+        if (grid.Width() < 3 || grid.Height() < 3 || grid.Width() % 2 == 0 || grid.Height() % 2 == 0) return false;
+        if (static_cast<std::uint64_t>(out.cols) * static_cast<std::uint64_t>(out.rows) >= std::numeric_limits<std::uint32_t>::max()) return false;
+
+        switch (method) {
+        case SolveMethod::Bfs:           out.solved = bfs(grid, out); break;
+        case SolveMethod::AStar:         out.solved = aStar(grid, out); break;
+        case SolveMethod::Bidirectional: out.solved = bidirectional(grid, out); break;
+        case SolveMethod::DeadEndFill:   out.solved = deadEndFill(grid, out); break;
+        default: break;
+        }
+
+        if (!out.solved) out.path.clear();
+        out.stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        return out.solved;
+    }
+
+    bool Solver::bfs(const Grid& grid, Solution& out) {
+        /* Breadth First Search
+
+            Visits cells in order of their distance from the entrance, so the first time the exit
+            is reached it is by a shortest path. A cell is marked as seen when it is queued (not
+            when it is taken out), so every cell enters the queue at most once.
+        */
+        const CellView view(grid);
+        const size_t cellCount = static_cast<size_t>(view.cols) * static_cast<size_t>(view.rows);
+        std::uint32_t start, goal;
+        if (!findEnds(grid, view, out, start, goal)) return false;
+
+        clearBits(m_Seen, cellCount);
+        m_From.resize(cellCount); // no need to clear - only read for cells that were seen
+        m_Queue.Reset();
+
+        setBit(m_Seen, start);
+        m_Queue.Push(start);
+
+        while (!m_Queue.Empty()) {
+            out.stats.maxFrontier = std::max(out.stats.maxFrontier, m_Queue.count);
+            const std::uint32_t cell = m_Queue.Pop();
+            out.stats.visited++;
+
+            if (cell == goal) {
+                tracePath(view, m_From, goal, start, out.path);
+                return true;
+            }
+
+            const int cy = static_cast<int>(cell / static_cast<std::uint32_t>(view.cols));
+            const int cx = static_cast<int>(cell - static_cast<std::uint32_t>(cy) * static_cast<std::uint32_t>(view.cols));
+            for (int dir = 0; dir < 4; dir++) {
+                if (!view.Open(cx, cy, dir)) continue;
+                const std::uint32_t next = view.Step(cell, dir);
+                if (testBit(m_Seen, next)) continue;
+
+                setBit(m_Seen, next);
+                m_From[next] = static_cast<std::uint8_t>(dir);
+                m_Queue.Push(next);
+            }
+        }
+        return false;
+    }
+
+    bool Solver::aStar(const Grid& grid, Solution& out) {
+        /* A* Search
+
+            Like breadth first search, but the next cell is always one with the smallest
+            cost = distance travelled + Manhattan distance to the exit. The estimate never
+            overestimates on a grid, so the path is still a shortest one, and regions leading
+            away from the exit are looked at last.
+
+            Radix (Bucket) Queue
+                A general heap costs O(log n) per operation. Here every step adds 1 to the distance
+                travelled and changes the estimate by exactly 1, so a neighbour's cost is either the
+                same as the current cost (moved towards the exit) or 2 more (moved away). The open
+                set therefore only ever holds two costs, and two plain arrays - one per cost - are a
+                complete priority queue with O(1) push and pop. When the current bucket runs dry the
+                next one takes over and the cost goes up by 2.
+
+                The current bucket is used as a stack, so among equal costs the newest (deepest) cell
+                comes first - in a maze that follows a corridor to its end before backing up.
+                A cell may be pushed more than once; it is final the first time it is taken out and
+                later copies are skipped.
+        */
+        const CellView view(grid);
+        const size_t cellCount = static_cast<size_t>(view.cols) * static_cast<size_t>(view.rows);
+        std::uint32_t start, goal;
+        if (!findEnds(grid, view, out, start, goal)) return false;
+
+        clearBits(m_Seen, cellCount); // seen = closed (taken out of the queue)
+        m_From.resize(cellCount);
+        m_Bucket[0].clear();
+        m_Bucket[1].clear();
+
+        // Entries are the cell in the low 32 bits and the direction it was reached from above them
+        m_Bucket[0].push_back(start);
+        int current = 0;
+
+        while (!m_Bucket[current].empty() || !m_Bucket[current ^ 1].empty()) {
+            if (m_Bucket[current].empty()) current ^= 1; // every cell at this cost is done - move on to cost + 2
+
+            out.stats.maxFrontier = std::max(out.stats.maxFrontier, m_Bucket[0].size() + m_Bucket[1].size());
+            const std::uint64_t entry = m_Bucket[current].back();
+            m_Bucket[current].pop_back();
+
+            const std::uint32_t cell = static_cast<std::uint32_t>(entry);
+            if (testBit(m_Seen, cell)) continue; // stale copy, the cell was already closed
+            setBit(m_Seen, cell);
+            if (cell != start) m_From[cell] = static_cast<std::uint8_t>(entry >> 32);
+            out.stats.visited++;
+
+            if (cell == goal) {
+                tracePath(view, m_From, goal, start, out.path);
+                return true;
+            }
+
+            const int cy = static_cast<int>(cell / static_cast<std::uint32_t>(view.cols));
+            const int cx = static_cast<int>(cell - static_cast<std::uint32_t>(cy) * static_cast<std::uint32_t>(view.cols));
+            const int goalY = static_cast<int>(goal / static_cast<std::uint32_t>(view.cols));
+            const int goalX = static_cast<int>(goal - static_cast<std::uint32_t>(goalY) * static_cast<std::uint32_t>(view.cols));
+
+            for (int dir = 0; dir < 4; dir++) {
+                if (!view.Open(cx, cy, dir)) continue;
+                const std::uint32_t next = view.Step(cell, dir);
+                if (testBit(m_Seen, next)) continue;
+
+                // Towards the exit keeps the cost, away from it adds 2
+                const bool closer = (dir == kUp && goalY < cy) || (dir == kDown && goalY > cy) ||
+                                    (dir == kLeft && goalX < cx) || (dir == kRight && goalX > cx);
+                m_Bucket[closer ? current : current ^ 1].push_back(next | (static_cast<std::uint64_t>(dir) << 32));
+            }
+        }
+        return false;
+    }
+
+    bool Solver::bidirectional(const Grid& grid, Solution& out) {
+        /* Bidirectional Breadth First Search
+
+            Two breadth first searches, one from the entrance and one from the exit. Each round the
+            side with the smaller frontier expands one whole level. When a cell reached by one side
+            finds a neighbour already seen by the other side, the two half paths are joined there.
+            Each search only has to cover about half the distance, which in open areas is far fewer
+            cells than one search covering all of it.
+
+            m_From holds both sides: the low 2 bits for the entrance side, the next 2 for the exit side.
+        */
+        const CellView view(grid);
+        const size_t cellCount = static_cast<size_t>(view.cols) * static_cast<size_t>(view.rows);
+        std::uint32_t start, goal;
+        if (!findEnds(grid, view, out, start, goal)) return false;
+
+        if (start == goal) {
+            out.path.push_back(start);
+            out.stats.visited = 1;
+            return true;
+        }
+
+        clearBits(m_Seen, cellCount);
+        clearBits(m_SeenOther, cellCount);
+        m_From.resize(cellCount);
+        m_Queue.Reset();
+        m_QueueOther.Reset();
+
+        setBit(m_Seen, start);
+        setBit(m_SeenOther, goal);
+        m_Queue.Push(start);
+        m_QueueOther.Push(goal);
+
+        // Walks back one side's directions from cell to that side's root, appending cells root last
+        auto walkBack = [&](std::uint32_t cell, int side, std::uint32_t root) {
+            for (; cell != root; cell = view.Step(cell, ((m_From[cell] >> (2 * side)) & 3) ^ 1)) out.path.push_back(cell);
+            out.path.push_back(root);
+        };
+
+        while (!m_Queue.Empty() && !m_QueueOther.Empty()) {
+            out.stats.maxFrontier = std::max(out.stats.maxFrontier, m_Queue.count + m_QueueOther.count);
+
+            const int side = (m_Queue.count <= m_QueueOther.count) ? 0 : 1;
+            CellQueue& queue = side == 0 ? m_Queue : m_QueueOther;
+            std::vector<Grid::Word>& mine = side == 0 ? m_Seen : m_SeenOther;
+            const std::vector<Grid::Word>& theirs = side == 0 ? m_SeenOther : m_Seen;
+
+            for (size_t level = queue.count; level > 0; level--) {
+                const std::uint32_t cell = queue.Pop();
+                out.stats.visited++;
+
+                const int cy = static_cast<int>(cell / static_cast<std::uint32_t>(view.cols));
+                const int cx = static_cast<int>(cell - static_cast<std::uint32_t>(cy) * static_cast<std::uint32_t>(view.cols));
+                for (int dir = 0; dir < 4; dir++) {
+                    if (!view.Open(cx, cy, dir)) continue;
+                    const std::uint32_t next = view.Step(cell, dir);
+
+                    if (testBit(theirs, next)) {
+                        // The searches meet between cell and next
+                        const std::uint32_t nearStart = side == 0 ? cell : next;
+                        const std::uint32_t nearGoal = side == 0 ? next : cell;
+                        walkBack(nearStart, 0, start);
+                        std::reverse(out.path.begin(), out.path.end());
+                        walkBack(nearGoal, 1, goal);
+                        return true;
+                    }
+                    if (testBit(mine, next)) continue;
+
+                    setBit(mine, next);
+                    m_From[next] = static_cast<std::uint8_t>((m_From[next] & ~(3 << (2 * side))) | (dir << (2 * side)));
+                    queue.Push(next);
+                }
+            }
+        }
+        return false;
+    }
+
+    bool Solver::deadEndFill(const Grid& grid, Solution& out) {
+        /* Dead-End Filling
+
+            A dead end is a cell with only one way out - it can never be on the path (unless it is
+            the entrance or exit). Fill it in, and its neighbour loses a way out; if that makes the
+            neighbour a dead end, fill it too. When nothing is left to fill, only the cells on the
+            path remain (plus any loops, in mazes that have them).
+
+            A stack of cells waiting to be filled replaces repeated sweeps over the whole maze, so
+            every cell is looked at a constant number of times. The remaining cells are then walked
+            with a breadth first search that treats filled cells as already seen - in a perfect maze
+            it only ever touches the path itself.
+        */
+        const CellView view(grid);
+        const size_t cellCount = static_cast<size_t>(view.cols) * static_cast<size_t>(view.rows);
+        std::uint32_t start, goal;
+        if (!findEnds(grid, view, out, start, goal)) return false;
+
+        clearBits(m_Seen, cellCount); // seen = filled
+        m_From.resize(cellCount);     // per cell: the open ways out as a 4 bit mask (bit = direction), plus kFilled
+        const std::uint8_t kFilled = 0x10;
+
+        // Collect the ways out of every cell, reading the grid rows around a row of cells directly
+        std::uint32_t cell = 0;
+        for (int cy = 0; cy < view.rows; cy++) {
+            const int gy = 2 * cy + 1;
+            const Grid::Word* above = cy > 0 ? grid.Row(gy - 1) : nullptr;
+            const Grid::Word* above2 = cy > 0 ? grid.Row(gy - 2) : nullptr;
+            const Grid::Word* here = grid.Row(gy);
+            const Grid::Word* below = cy + 1 < view.rows ? grid.Row(gy + 1) : nullptr;
+            const Grid::Word* below2 = cy + 1 < view.rows ? grid.Row(gy + 2) : nullptr;
+            auto open = [](const Grid::Word* row, int x) { return ((row[x / Grid::kWordBits] >> (x % Grid::kWordBits)) & 1u) == 0; };
+
+            for (int cx = 0; cx < view.cols; cx++, cell++) {
+                const int gx = 2 * cx + 1;
+                std::uint8_t ways = 0;
+                if (above && open(above, gx) && open(above2, gx))                     ways |= 1 << kUp;
+                if (below && open(below, gx) && open(below2, gx))                     ways |= 1 << kDown;
+                if (cx > 0 && open(here, gx - 1) && open(here, gx - 2))               ways |= 1 << kLeft;
+                if (cx + 1 < view.cols && open(here, gx + 1) && open(here, gx + 2))   ways |= 1 << kRight;
+                m_From[cell] = ways;
+            }
+        }
+
+        // Fill each dead end and keep following the corridor it belongs to while that keeps producing
+        // new dead ends. Filling a cell removes the way back to it from the neighbour it leads to, so a
+        // cell's mask always holds exactly its unfilled neighbours and the next step needs no wall tests.
+        // No list of pending cells is needed, and the cells filled one after the other are neighbours.
+        static const std::int8_t s_OnlyWay[16] = { -1, kUp, kDown, -1, kLeft, -1, -1, -1, kRight, -1, -1, -1, -1, -1, -1, -1 };
+
+        for (cell = 0; cell < cellCount; cell++) {
+            const std::uint8_t ways = m_From[cell];
+            if ((ways & kFilled) || (ways & (ways - 1)) || cell == start || cell == goal) continue; // filled, or 2+ ways out
+
+            std::uint32_t dead = cell;
+            size_t chain = 0;
+            for (;;) {
+                m_From[dead] |= kFilled;
+                setBit(m_Seen, dead);
+                out.stats.visited++;
+                chain++;
+
+                const int way = s_OnlyWay[m_From[dead] & 0x0F];
+                if (way < 0) break; // nothing left around it
+
+                const std::uint32_t next = view.Step(dead, way);
+                const std::uint8_t left = m_From[next] &= static_cast<std::uint8_t>(~(1 << (way ^ 1)));
+                if ((left & (left - 1)) || next == start || next == goal) break; // still 2+ ways out - not a dead end
+
+                dead = next; // the neighbour just became a dead end - fill it next
+            }
+            out.stats.maxFrontier = std::max(out.stats.maxFrontier, chain); // longest corridor filled in one go
+        }
+
+        // Walk what is left from the entrance to the exit
+        if (testBit(m_Seen, start)) return false;
+        m_Queue.Reset();
+        setBit(m_Seen, start);
+        m_Queue.Push(start);
+
+        while (!m_Queue.Empty()) {
+            const std::uint32_t here = m_Queue.Pop();
+            out.stats.visited++;
+            if (here == goal) {
+                tracePath(view, m_From, goal, start, out.path);
+                return true;
+            }
+
+            const int cy = static_cast<int>(here / static_cast<std::uint32_t>(view.cols));
+            const int cx = static_cast<int>(here - static_cast<std::uint32_t>(cy) * static_cast<std::uint32_t>(view.cols));
+            for (int dir = 0; dir < 4; dir++) {
+                if (!view.Open(cx, cy, dir)) continue;
+                const std::uint32_t next = view.Step(here, dir);
+                if (testBit(m_Seen, next)) continue;
+
+                setBit(m_Seen, next);
+                m_From[next] = static_cast<std::uint8_t>(dir); // the degree is no longer needed once a cell is reached
+                m_Queue.Push(next);
+            }
+        }
+        return false;
+    }
+
+    void MarkSolution(const Solution& solution, Grid& overlay) {
+        overlay.Assign(solution.width, solution.height, false);
+        if (!solution.solved || solution.path.empty()) return;
+
+        overlay.SetWall(solution.startX, solution.startY);
+        overlay.SetWall(solution.goalX, solution.goalY);
+
+        const std::uint32_t cols = static_cast<std::uint32_t>(solution.cols);
+        int prevX = -1, prevY = -1;
+        for (std::uint32_t cell : solution.path) {
+            const int x = 2 * static_cast<int>(cell % cols) + 1, y = 2 * static_cast<int>(cell / cols) + 1;
+            overlay.SetWall(x, y);
+            if (prevX >= 0) overlay.SetWall((x + prevX) / 2, (y + prevY) / 2); // the opening between two path cells
+            prevX = x;
+            prevY = y;
+        }
+    }
+
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: stats.cpp
+ * Description:
+ * Prints the generation statistics collected by the instrumentation layer.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "stats.h"
+#include <iomanip>
+#include <ostream>
+
+namespace MazeGen {
+
+    static double perSecond(double amount, double seconds) {
+        return seconds > 0.0 ? amount / seconds : 0.0;
+    }
+
+    static double megabytes(std::uint64_t bytes) {
+        return static_cast<double>(bytes) / (1024.0 * 1024.0);
+    }
+
+    void PrintGenerationStats(std::ostream& out, const GenerationStats& stats) {
+        if (!stats.enabled) {
+            out << "Statistics are not available - this build was configured with MAZEGEN_ENABLE_STATS=OFF.\n";
+            return;
+        }
+
+        const double cells = static_cast<double>(stats.width) * static_cast<double>(stats.height);
+        const std::ios::fmtflags flags = out.flags();
+        out << std::fixed << std::setprecision(3);
+
+        if (stats.width == 0) {
+            out << "No maze has been generated yet.\n";
+        }
+        else {
+            out << "Last generation (" << stats.width << "x" << stats.height << ", " << stats.threads << " thread(s))\n"
+                << "    total:           " << stats.generateSeconds * 1000.0 << " ms ("
+                << perSecond(cells, stats.generateSeconds) / 1e6 << " M cells/s)\n"
+                << "    carving:         " << stats.carveSeconds * 1000.0 << " ms\n"
+                << "    entrance/exit:   " << stats.entranceSeconds * 1000.0 << " ms\n"
+                << "    cells visited:   " << stats.carve.cellsVisited << '\n'
+                << "    walls removed:   " << stats.carve.wallsRemoved << '\n'
+                << "    steps:           " << stats.carve.steps << '\n'
+                << "    max depth:       " << stats.carve.maxDepth << '\n'
+                << "    grid memory:     " << megabytes(stats.gridBytes) << " MB\n"
+                << "    peak memory:     " << megabytes(stats.peakBytes) << " MB (grid + algorithm buffers)\n";
+        }
+
+        if (stats.displaySeconds > 0.0) out << "Last display:        " << stats.displaySeconds * 1000.0 << " ms\n";
+        if (stats.saveSeconds > 0.0) {
+            out << "Last save:           " << stats.saveSeconds * 1000.0 << " ms, " << stats.savedBytes << " bytes ("
+                << perSecond(megabytes(stats.savedBytes), stats.saveSeconds) << " MB/s)\n";
+        }
+        if (stats.loadSeconds > 0.0) {
+            out << "Last load:           " << stats.loadSeconds * 1000.0 << " ms, " << stats.loadedBytes << " bytes ("
+                << perSecond(megabytes(stats.loadedBytes), stats.loadSeconds) << " MB/s)\n";
+        }
+
+        out.flags(flags);
+    }
+
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: stream.cpp
+ * Description:
+ * Implements streaming maze generation and the built-in row sinks.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "stream.h"
+#include "algorithm.h" // Used for EllerRows
+#include "checksum.h"  // Used for Crc32()
+#include "maze_io.h"   // Used for the save file header
+#include <algorithm>   // Used for std::fill()
+#include <cstdio>
+#include <vector>
+
+namespace MazeGen {
+
+    // ***********************************
+    // SINKS
+    // ***********************************
+
+    FileRowSink::FileRowSink(const std::string& filename, std::uint64_t seed, RngKind kind)
+        : m_TempName(TempFileName(filename)), m_File(m_TempName, std::ios::binary) {
+        m_Header.m_Name = filename; // same name SaveToFile gives a maze
+        m_Header.m_Algorithm = Algorithm::Eller;
+        m_Header.m_RngKind = kind;
+        m_Header.m_Seed = seed;
+    }
+
+    FileRowSink::~FileRowSink() {
+        if (m_Done) return;
+        m_File.close();
+        std::remove(m_TempName.c_str());
+    }
+
+    bool FileRowSink::Begin(int width, int height) {
+        if (!m_File || !m_File.is_open()) return false;
+
+        // The sizes are all known now - only the payload checksum is still a placeholder
+        m_Header.m_Width = width;
+        m_Header.m_Height = height;
+        EncodeMazeHeader(m_Header, 0, m_Bytes);
+        m_File.write(reinterpret_cast<const char*>(m_Bytes.data()), static_cast<std::streamsize>(m_Bytes.size()));
+
+        m_Row.Assign(width, 1, false);
+        m_Crc = 0;
+        return static_cast<bool>(m_File);
+    }
+
+    bool FileRowSink::WriteRow(const char* row, int) {
+        m_Row.RowFromChars(0, row);
+        m_Bytes.clear();
+        EncodeRow(m_Row, 0, m_Bytes);
+        m_Crc = Crc32(m_Bytes.data(), m_Bytes.size(), m_Crc);
+
+        m_File.write(reinterpret_cast<const char*>(m_Bytes.data()), static_cast<std::streamsize>(m_Bytes.size()));
+        return static_cast<bool>(m_File);
+    }
+
+    bool FileRowSink::End() {
+        // Patch the header with the checksum of every row
+        EncodeMazeHeader(m_Header, m_Crc, m_Bytes);
+        m_File.seekp(0);
+        m_File.write(reinterpret_cast<const char*>(m_Bytes.data()), static_cast<std::streamsize>(m_Bytes.size()));
+        m_File.close();
+        if (m_File.fail()) return false;
+
+        m_Done = ReplaceFile(m_TempName, m_Header.m_Name);
+        return m_Done;
+    }
+
+    bool ConsoleRowSink::Begin(int, int) {
+        m_Out.Append("Viewing \'" + m_Name + "\' maze!\n\n");
+        return m_Out.Good();
+    }
+
+    bool ConsoleRowSink::WriteRow(const char* row, int width) {
+        m_Out.Append(row, width);
+        m_Out.Put('\n');
+        return m_Out.Good();
+    }
+
+    bool ConsoleRowSink::End() {
+        return m_Out.Flush() && std::fflush(stdout) == 0;
+    }
+
+    // ***********************************
+    // GENERATION
+    // ***********************************
+
+    bool StreamMaze(int width, int height, Rng& rng, RowSink& sink) {
+        // Needs at least one cell, and the same odd-dimension layout as MazeGenerator
+        if (width < 3 || height < 3 || width % 2 == 0 || height % 2 == 0) return false;
+
+        const CellRegion region = CellRegion::Full(width, height);
+
+        EllerRows rows;
+        rows.Begin(region.cols);
+
+        std::vector<char> line(width); // the only row buffer - reused for every grid row
+
+        if (!sink.Begin(width, height)) return false;
+
+        // Top border with the entrance. Every cell in Eller's first row is open, so the first
+        // open cell (the one addEntranceAndExit picks) is always x = 1
+        std::fill(line.begin(), line.end(), '#');
+        line[1] = ' ';
+        if (!sink.WriteRow(line.data(), width)) return false;
+
+        for (int r = 0; r < region.rows; r++) {
+            const bool lastRow = (r == region.rows - 1);
+            rows.NextRow(rng, lastRow);
+
+            // Row of cells: open cells, walls between them depend on Right()
+            std::fill(line.begin(), line.end(), '#');
+            for (int c = 0; c < region.cols; c++) {
+                const int gx = region.GridX(c);
+                line[gx] = ' ';
+                if (rows.Right()[c]) line[gx + 1] = ' ';
+            }
+            if (!sink.WriteRow(line.data(), width)) return false;
+
+            // Row of walls below the cells, open where Down() says so (skipped after the last row)
+            if (!lastRow) {
+                std::fill(line.begin(), line.end(), '#');
+                for (int c = 0; c < region.cols; c++) {
+                    if (rows.Down()[c]) line[region.GridX(c)] = ' ';
+                }
+                if (!sink.WriteRow(line.data(), width)) return false;
+            }
+        }
+
+        // Bottom border with the exit - same draw as addEntranceAndExit, where every cell column is a valid exit
+        std::fill(line.begin(), line.end(), '#');
+        line[region.GridX(static_cast<int>(rng.Bounded(region.cols)))] = ' ';
+        if (!sink.WriteRow(line.data(), width)) return false;
+
+        return sink.End();
+    }
+
+}
@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: thread_pool.cpp
+ * Description:
+ * Implements the fixed-size thread pool.
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "thread_pool.h"
+#include <atomic>
+#include <algorithm>
+
+namespace MazeGen {
+
+    ThreadPool::ThreadPool(size_t threads) {
+        if (threads == 0) threads = HardwareThreads();
+
+        m_Workers.reserve(threads);
+        for (size_t i = 0; i < threads; i++) {
+            m_Workers.emplace_back(&ThreadPool::workerLoop, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_TaskReady.notify_all();
+
+        for (std::thread& worker : m_Workers) worker.join();
+    }
+
+    size_t ThreadPool::HardwareThreads() {
+        unsigned int count = std::thread::hardware_concurrency();
+        return count > 0 ? count : 1; // hardware_concurrency may return 0 if it cannot tell
+    }
+
+    void ThreadPool::Submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Tasks.push_back(std::move(task));
+        }
+        m_TaskReady.notify_one();
+    }
+
+    void ThreadPool::Wait() {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Idle.wait(lock, [this] { return m_Tasks.empty() && m_Active == 0; });
+    }
+
+    void ThreadPool::runJob(size_t count, JobFunction function, const void* context) {
+        if (count == 0) return;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_JobDone.wait(lock, [this] { return m_JobSeats == 0; }); // one job at a time if several threads call ParallelFor
+
+        m_JobFunction = function;
+        m_JobContext = context;
+        m_JobCount = count;
+        m_JobNext = 0;
+        m_JobSeats = std::min(count, Size()); // worker index stays below Size(), and no idle seat when count is small
+        m_JobSeatsTaken = 0;
+        m_JobNumber++;
+        m_TaskReady.notify_all();
+
+        // The body lives on the caller's stack frame, so the job only ends once every index ran and no worker is inside it
+        m_JobDone.wait(lock, [this] { return m_JobNext.load() >= m_JobCount && m_JobRunning == 0; });
+
+        m_JobSeats = 0;
+        m_JobFunction = nullptr;
+        m_JobContext = nullptr;
+        m_JobDone.notify_all(); // lets a waiting ParallelFor from another thread in
+    }
+
+    void ThreadPool::workerLoop() {
+        std::uint64_t lastJob = 0;
+
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                auto canJoin = [&] { return m_JobSeatsTaken < m_JobSeats && m_JobNumber != lastJob; };
+                m_TaskReady.wait(lock, [&] { return m_Stop || !m_Tasks.empty() || canJoin(); });
+
+                if (canJoin()) {
+                    // Keep taking the next index until none are left. This balances uneven work
+                    // (a slow index does not hold up a fixed share of the others).
+                    lastJob = m_JobNumber;
+                    const size_t seat = m_JobSeatsTaken++;
+                    const JobFunction function = m_JobFunction;
+                    const void* context = m_JobContext;
+                    const size_t count = m_JobCount;
+                    m_JobRunning++;
+                    lock.unlock();
+
+                    for (size_t index = m_JobNext++; index < count; index = m_JobNext++) {
+                        function(context, index, seat);
+                    }
+
+                    lock.lock();
+                    m_JobRunning--;
+                    if (m_JobRunning == 0) m_JobDone.notify_all();
+                    continue;
+                }
+
+                if (m_Stop && m_Tasks.empty()) return;
+
+                task = std::move(m_Tasks.front());
+                m_Tasks.pop_front();
+                m_Active++;
+            }
+
+            task();
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Active--;
+                if (m_Active == 0 && m_Tasks.empty()) m_Idle.notify_all();
+            }
+        }
+    }
+
+}
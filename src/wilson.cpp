@@ -0,0 +1,109 @@
+/******************************************************************************
+ * Project: Maze Generator - Console App
+ * File: wilson.cpp
+ * Description:
+ * Implements Wilson's algorithm (loop-erased random walks).
+ *
+ * Copyright © 2025 Ghost - Two Byte Tech. All Rights Reserved.
+ *
+ * This source code is licensed under the MIT License. For more details, see
+ * the LICENSE file in the root directory of this project.
+ *
+ * Version: v1.0.0
+ * Author: Ghost
+ * Created On: 10-17-2026
+ * Last Modified: 10-17-2026
+ *****************************************************************************/
+
+#include "algorithm.h"
+
+namespace MazeGen {
+
+    void WilsonAlgorithm::Reserve(const CellRegion& region) {
+        m_Walk.reserve(region.CellCount());
+    }
+
+    void WilsonAlgorithm::Carve(Grid& grid, const CellRegion& region, Rng& rng) {
+        /* Wilson's Algorithm
+
+            Every possible perfect maze is equally likely with this algorithm (a uniform spanning tree).
+            It starts with one random cell in the maze. Then, for every cell that is not in the maze yet:
+                1. Walk randomly from it until the walk hits the maze. For every cell the walk leaves,
+                   remember only the LAST direction it left by - this erases any loops automatically.
+                2. Start again from the first cell and follow the remembered directions, adding every
+                   cell on the way to the maze and opening the walls between them.
+
+            m_Walk holds one byte per cell: the remembered direction (0-3) or kInMaze.
+        */
+        static const std::uint8_t kInMaze = 4;
+        static const int dx[] = { 0, 0, -1, 1 }; // Up, Down, Left, Right - same order as the backtracker
+        static const int dy[] = { -1, 1, 0, 0 };
+
+        const int cols = region.cols, rows = region.rows;
+        const size_t cellCount = region.CellCount();
+        if (cellCount == 0) return;
+
+        Reserve(region);
+        m_Walk.assign(cellCount, 0);
+
+        auto stepOf = [cols](int dir) -> std::int64_t { return dir < 2 ? (dir == 0 ? -cols : cols) : (dir == 2 ? -1 : 1); };
+
+        size_t first = static_cast<size_t>(rng.Bounded64(cellCount));
+        m_Walk[first] = kInMaze;
+        grid.SetPassage(region.GridX(static_cast<int>(first % cols)), region.GridY(static_cast<int>(first / cols)));
+        MAZEGEN_STAT(m_Counters.cellsVisited++);
+
+        std::uint32_t bits = 0;
+        int bitsLeft = 0;
+
+        for (size_t start = 0; start < cellCount; start++) {
+            if (m_Walk[start] == kInMaze) continue;
+
+            // 1. Random walk until the maze is hit, remembering the last exit direction of each cell
+            size_t index = start;
+            int cx = static_cast<int>(start % cols), cy = static_cast<int>(start / cols);
+            MAZEGEN_STAT(std::uint64_t walkLength = 0);
+            while (m_Walk[index] != kInMaze) {
+                int dir;
+                do {
+                    // Two random bits per direction, refilled 32 bits at a time
+                    if (bitsLeft == 0) {
+                        bits = static_cast<std::uint32_t>(rng());
+                        bitsLeft = 16;
+                    }
+                    dir = static_cast<int>(bits & 3u);
+                    bits >>= 2;
+                    bitsLeft--;
+                } while (cx + dx[dir] < 0 || cx + dx[dir] >= cols || cy + dy[dir] < 0 || cy + dy[dir] >= rows);
+
+                m_Walk[index] = static_cast<std::uint8_t>(dir);
+                cx += dx[dir];
+                cy += dy[dir];
+                index = static_cast<size_t>(static_cast<std::int64_t>(index) + stepOf(dir));
+                MAZEGEN_STAT(walkLength++);
+            }
+            MAZEGEN_STAT(m_Counters.steps += walkLength, StatMax(m_Counters.maxDepth, walkLength));
+
+            // 2. Follow the loop-erased path again and add it to the maze
+            index = start;
+            cx = static_cast<int>(start % cols);
+            cy = static_cast<int>(start / cols);
+            while (m_Walk[index] != kInMaze) {
+                int dir = m_Walk[index];
+                int gx = region.GridX(cx), gy = region.GridY(cy);
+
+                m_Walk[index] = kInMaze;
+                grid.SetPassage(gx, gy);
+                grid.SetPassage(gx + dx[dir], gy + dy[dir]); // the wall between this cell and the next
+                MAZEGEN_STAT(m_Counters.cellsVisited++, m_Counters.wallsRemoved++);
+
+                cx += dx[dir];
+                cy += dy[dir];
+                index = static_cast<size_t>(static_cast<std::int64_t>(index) + stepOf(dir));
+            }
+        }
+
+        MAZEGEN_STAT(StatMax(m_Counters.scratchBytes, m_Walk.capacity()));
+    }
+
+}